@@ -0,0 +1,54 @@
+#pragma once
+
+#include "BenchmarkUtility.h"
+#include "AllocationCounter.h"
+#include "../FJobSystem.h"
+
+namespace t3d::benchmark
+{
+	inline void RunAllocationBenchmark()
+	{
+		PrintTitle("Heap allocations per Schedule/Await");
+
+		constexpr size_t WarmupJobs   = 10000;
+		constexpr size_t MeasuredJobs = 100000;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 4;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		int64_t Sum = 0;
+
+		auto RunJobs = [&](size_t Count)
+			{
+				for (size_t i = 0; i < Count; ++i)
+				{
+					const int64_t Value = static_cast<int64_t>(i);
+
+					Sum += JobSystem.Schedule([Value]() { return Value * 2; })->Await();
+					Sum += JobSystem.Schedule(i % 4, [Value]() { return Value; })->Await();
+				}
+			};
+
+		// Slabs and deque rings grow here.
+		RunJobs(WarmupJobs);
+
+		const uint64_t Before = GetHeapAllocationCount();
+
+		RunJobs(MeasuredJobs);
+
+		const uint64_t After = GetHeapAllocationCount();
+
+		JobSystem.Shutdown();
+
+		std::printf("%zu jobs, %llu heap allocations, %.4f per job (checksum %lld)\n",
+			MeasuredJobs * 2,
+			static_cast<unsigned long long>(After - Before),
+			static_cast<double>(After - Before) / static_cast<double>(MeasuredJobs * 2),
+			static_cast<long long>(Sum));
+	}
+}
\ No newline at end of file
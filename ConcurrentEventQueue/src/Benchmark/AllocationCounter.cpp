@@ -0,0 +1,69 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace t3d::benchmark
+{
+	static std::atomic<uint64_t> HeapAllocationCount = 0;
+
+	uint64_t GetHeapAllocationCount()
+	{
+		return HeapAllocationCount.load(std::memory_order_relaxed);
+	}
+}
+
+void* operator new(size_t Size)
+{
+	t3d::benchmark::HeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* Memory = std::malloc(Size ? Size : 1))
+	{
+		return Memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t Size, std::align_val_t Alignment)
+{
+	t3d::benchmark::HeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	const size_t Align = static_cast<size_t>(Alignment);
+
+#if defined _MSC_VER
+	if (void* Memory = _aligned_malloc(Size ? Size : 1, Align))
+#else
+	if (void* Memory = std::aligned_alloc(Align, (Size + Align - 1) / Align * Align))
+#endif
+	{
+		return Memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* Memory) noexcept
+{
+	std::free(Memory);
+}
+
+void operator delete(void* Memory, size_t) noexcept
+{
+	std::free(Memory);
+}
+
+void operator delete(void* Memory, std::align_val_t) noexcept
+{
+#if defined _MSC_VER
+	_aligned_free(Memory);
+#else
+	std::free(Memory);
+#endif
+}
+
+void operator delete(void* Memory, size_t, std::align_val_t Alignment) noexcept
+{
+	operator delete(Memory, Alignment);
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+namespace t3d::benchmark
+{
+	// Number of global operator new calls so far, counted by the replacement operators in AllocationCounter.cpp.
+	uint64_t GetHeapAllocationCount ();
+}
\ No newline at end of file
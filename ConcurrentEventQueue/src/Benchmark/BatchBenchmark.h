@@ -0,0 +1,71 @@
+#pragma once
+
+#include "BenchmarkUtility.h"
+#include "../FJobSystem.h"
+
+#include <atomic>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	inline void RunBatchBenchmark()
+	{
+		PrintTitle("Submitting tiny jobs: Schedule loop vs ScheduleBatch");
+
+		constexpr size_t Repetitions = 20;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 4;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		std::atomic<size_t> Executed = 0;
+
+		auto Job = [&Executed]() { Executed.fetch_add(1, std::memory_order_relaxed); };
+
+		std::printf("%10s %18s %18s %10s\n", "Jobs", "Loop (Mjob/s)", "Batch (Mjob/s)", "Speedup");
+
+		for (size_t JobCount = 1000; JobCount <= 100000; JobCount *= 10)
+		{
+			std::vector<decltype(Job)>     Jobs(JobCount, Job);
+			std::vector<JobHandle_T<void>> Handles(JobCount);
+			std::vector<int64_t>           LoopSamples;
+			std::vector<int64_t>           BatchSamples;
+
+			for (size_t Repetition = 0; Repetition < Repetitions; ++Repetition)
+			{
+				FStopwatch Stopwatch;
+
+				for (size_t i = 0; i < JobCount; ++i)
+				{
+					Handles[i] = JobSystem.Schedule(Job);
+				}
+
+				for (auto& Handle : Handles)
+				{
+					Handle->Await();
+				}
+
+				LoopSamples.push_back(Stopwatch.GetNanoseconds());
+
+				Handles.assign(JobCount, nullptr);
+
+				Stopwatch.Reset();
+
+				JobSystem.ScheduleBatch(std::span(Jobs))->Await();
+
+				BatchSamples.push_back(Stopwatch.GetNanoseconds());
+			}
+
+			const double Loop  = static_cast<double>(JobCount) / (static_cast<double>(Percentile(LoopSamples, 0.5)) * 1e-9);
+			const double Batch = static_cast<double>(JobCount) / (static_cast<double>(Percentile(BatchSamples, 0.5)) * 1e-9);
+
+			std::printf("%10zu %18.2f %18.2f %9.2fx\n", JobCount, Loop / 1e6, Batch / 1e6, Batch / Loop);
+		}
+
+		JobSystem.Shutdown();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,239 @@
+#pragma once
+
+#include "../FJobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	// The textbook baseline: one mutex, one condition variable, one queue of std::function.
+	class FPlainThreadPool
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		explicit FPlainThreadPool(size_t WorkerCount)
+			: b_Running (true)
+		{
+			for (size_t i = 0; i < WorkerCount; ++i)
+			{
+				Workers.emplace_back([this]() { this->ExecuteJobs(); });
+			}
+		}
+
+		~FPlainThreadPool()
+		{
+			{
+				std::scoped_lock<std::mutex> Lock(QueueMutex);
+
+				b_Running = false;
+			}
+
+			QueueCondition.notify_all();
+
+			for (auto& Worker : Workers)
+			{
+				Worker.join();
+			}
+		}
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		void Submit(std::function<void()>&& Job)
+		{
+			{
+				std::scoped_lock<std::mutex> Lock(QueueMutex);
+
+				Jobs.push_back(std::move(Job));
+			}
+
+			QueueCondition.notify_one();
+		}
+
+	private:
+
+	// Private Functions:
+
+		void ExecuteJobs()
+		{
+			for (;;)
+			{
+				std::function<void()> Job;
+
+				{
+					std::unique_lock<std::mutex> Lock(QueueMutex);
+
+					QueueCondition.wait(Lock, [this]() { return !b_Running || !Jobs.empty(); });
+
+					if (Jobs.empty())
+					{
+						return;
+					}
+
+					Job = std::move(Jobs.front());
+
+					Jobs.pop_front();
+				}
+
+				Job();
+			}
+		}
+
+	// Variables:
+
+		std::mutex                        QueueMutex;
+		std::condition_variable           QueueCondition;
+		std::deque<std::function<void()>> Jobs;
+		std::vector<std::thread>          Workers;
+		bool                              b_Running;
+	};
+
+	// Every backend runs void jobs and hands out copyable handles. RunAfter chains a job behind another one.
+
+	class FJobSystemBackend
+	{
+	public:
+
+		using Handle_T = JobHandle_T<void>;
+
+		static constexpr const char* Name = "FJobSystem";
+
+	// Constructors and Destructor:
+
+		explicit FJobSystemBackend(size_t WorkerCount)
+			: JobSystem (MakeConfig(WorkerCount))
+		{
+			JobSystem.Startup();
+		}
+
+		~FJobSystemBackend()
+		{
+			JobSystem.Shutdown();
+		}
+
+	// Functions:
+
+		template<typename Functor_T>
+		Handle_T Run(Functor_T&& Job)
+		{
+			return JobSystem.Schedule(std::forward<Functor_T>(Job));
+		}
+
+		// No worker blocks, the job is held back until Previous signals.
+		template<typename Functor_T>
+		Handle_T RunAfter(const Handle_T& Previous, Functor_T&& Job)
+		{
+			return JobSystem.Schedule(std::forward<Functor_T>(Job), Previous);
+		}
+
+		static void Wait(const Handle_T& Handle)
+		{
+			Handle->Await();
+		}
+
+	private:
+
+		static FJobSystemConfig MakeConfig(size_t WorkerCount)
+		{
+			FJobSystemConfig Config;
+
+			Config.WorkerCount = static_cast<uint32_t>(WorkerCount);
+
+			return Config;
+		}
+
+	// Variables:
+
+		FJobSystem JobSystem;
+	};
+
+	class FThreadPoolBackend
+	{
+	public:
+
+		using Handle_T = std::shared_future<void>;
+
+		static constexpr const char* Name = "Thread pool";
+
+	// Constructors and Destructor:
+
+		explicit FThreadPoolBackend(size_t WorkerCount)
+			: Pool (WorkerCount)
+		{}
+
+	// Functions:
+
+		template<typename Functor_T>
+		Handle_T Run(Functor_T&& Job)
+		{
+			auto Task = std::make_shared<std::packaged_task<void()>>(std::forward<Functor_T>(Job));
+
+			Handle_T Handle = Task->get_future().share();
+
+			Pool.Submit([Task]() { (*Task)(); });
+
+			return Handle;
+		}
+
+		// No dependency support, the job blocks its worker until Previous is done.
+		template<typename Functor_T>
+		Handle_T RunAfter(const Handle_T& Previous, Functor_T&& Job)
+		{
+			return this->Run([Previous, Job = std::forward<Functor_T>(Job)]() mutable { Previous.wait(); Job(); });
+		}
+
+		static void Wait(const Handle_T& Handle)
+		{
+			Handle.wait();
+		}
+
+	private:
+
+	// Variables:
+
+		FPlainThreadPool Pool;
+	};
+
+	// A thread per job, the worker count does not apply.
+	class FAsyncBackend
+	{
+	public:
+
+		using Handle_T = std::shared_future<void>;
+
+		static constexpr const char* Name = "std::async";
+
+	// Constructors and Destructor:
+
+		explicit FAsyncBackend(size_t) {}
+
+	// Functions:
+
+		template<typename Functor_T>
+		Handle_T Run(Functor_T&& Job)
+		{
+			return std::async(std::launch::async, std::forward<Functor_T>(Job)).share();
+		}
+
+		template<typename Functor_T>
+		Handle_T RunAfter(const Handle_T& Previous, Functor_T&& Job)
+		{
+			return this->Run([Previous, Job = std::forward<Functor_T>(Job)]() mutable { Previous.wait(); Job(); });
+		}
+
+		static void Wait(const Handle_T& Handle)
+		{
+			Handle.wait();
+		}
+	};
+}
\ No newline at end of file
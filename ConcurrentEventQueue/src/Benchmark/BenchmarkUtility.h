@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	using Clock_T = std::chrono::steady_clock;
+
+	class FStopwatch
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		 FStopwatch () : Start(Clock_T::now()) {}
+		~FStopwatch () = default;
+
+	// Functions:
+
+		void Reset()
+		{
+			Start = Clock_T::now();
+		}
+
+	// Accessors:
+
+		double GetSeconds() const
+		{
+			return std::chrono::duration<double>(Clock_T::now() - Start).count();
+		}
+
+		int64_t GetNanoseconds() const
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_T::now() - Start).count();
+		}
+
+	private:
+
+	// Variables:
+
+		Clock_T::time_point Start;
+	};
+
+	// Nearest-rank percentile, Fraction in [0, 1]. Sorts the samples in place.
+	template<typename T>
+	T Percentile(std::vector<T>& Samples, double Fraction)
+	{
+		if (Samples.empty())
+		{
+			return T();
+		}
+
+		std::sort(Samples.begin(), Samples.end());
+
+		const size_t Index = std::min(Samples.size() - 1, static_cast<size_t>(Fraction * static_cast<double>(Samples.size())));
+
+		return Samples[Index];
+	}
+
+	inline void PrintTitle(const char* Title)
+	{
+		std::printf("\n== %s ==\n", Title);
+	}
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "BenchmarkUtility.h"
+#include "../FJobSystem.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	// Schedule + Await round trips of a job that does nothing, in nanoseconds.
+	inline std::vector<int64_t> MeasureRoundTrips(FJobSystem& JobSystem, size_t Count)
+	{
+		std::vector<int64_t> Samples;
+
+		Samples.reserve(Count);
+
+		for (size_t i = 0; i < Count; ++i)
+		{
+			FStopwatch Stopwatch;
+
+			JobSystem.Schedule([]() {})->Await();
+
+			Samples.push_back(Stopwatch.GetNanoseconds());
+		}
+
+		return Samples;
+	}
+
+	// A job that fans out a few tiny children and awaits them, the way gameplay code tends to.
+	inline std::vector<int64_t> MeasureNestedAwaits(FJobSystem& JobSystem, size_t Count)
+	{
+		constexpr size_t ChildCount = 8;
+
+		std::vector<int64_t> Samples;
+
+		Samples.reserve(Count);
+
+		for (size_t i = 0; i < Count; ++i)
+		{
+			FStopwatch Stopwatch;
+
+			JobSystem.Schedule([&JobSystem]()
+				{
+					std::array<JobHandle_T<size_t>, ChildCount> Children;
+
+					for (size_t Child = 0; Child < ChildCount; ++Child)
+					{
+						Children[Child] = JobSystem.Schedule([Child]() { return Child; });
+					}
+
+					size_t Sum = 0;
+
+					for (auto& Child : Children)
+					{
+						Sum += Child->Await();
+					}
+
+					return Sum;
+				})->Await();
+
+			Samples.push_back(Stopwatch.GetNanoseconds());
+		}
+
+		return Samples;
+	}
+
+	// Time from submitting a job to it starting, in nanoseconds. The workers sit idle for Gap before each submission,
+	// long enough for one that spins then parks to be parked.
+	template<typename Submit_T>
+	std::vector<int64_t> MeasureWakeUps(Submit_T&& Submit, size_t Count, std::chrono::microseconds Gap)
+	{
+		std::vector<int64_t> Samples;
+
+		Samples.reserve(Count);
+
+		std::atomic<int64_t> Started;
+
+		for (size_t i = 0; i < Count; ++i)
+		{
+			std::this_thread::sleep_for(Gap);
+
+			Started.store(0, std::memory_order_relaxed);
+
+			const Clock_T::time_point Submitted = Clock_T::now();
+
+			Submit([&Started, Submitted]()
+				{
+					Started.store(std::max<int64_t>(1, std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_T::now() - Submitted).count()), std::memory_order_release);
+				});
+
+			while (Started.load(std::memory_order_acquire) == 0)
+			{
+				CpuRelax();
+			}
+
+			Samples.push_back(Started.load(std::memory_order_relaxed));
+		}
+
+		return Samples;
+	}
+
+	inline void PrintLatencyRow(const char* Name, std::vector<int64_t>&& Samples)
+	{
+		std::printf("%-34s %10.2f %10.2f %10.2f\n", Name,
+			static_cast<double>(Percentile(Samples, 0.5))   / 1e3,
+			static_cast<double>(Percentile(Samples, 0.99))  / 1e3,
+			static_cast<double>(Percentile(Samples, 0.999)) / 1e3);
+	}
+
+	inline void RunLatencyBenchmark()
+	{
+		PrintTitle("Short job latency: spin-then-park and help-while-waiting");
+
+		constexpr size_t WarmupCount   = 1000;
+		constexpr size_t MeasuredCount = 20000;
+
+		std::printf("%-34s %10s %10s %10s\n", "", "p50 (us)", "p99 (us)", "p999 (us)");
+
+		struct FVariant
+		{
+			const char* Name;
+			uint32_t    IdleSpinCount;
+			bool        b_HelpWhileWaiting;
+		};
+
+		const FVariant Variants[] =
+		{
+			{ "park right away",              0,                             false },
+			{ "spin then park",               FAtomicLock::DefaultSpinCount, false },
+			{ "spin then park, help waiting", FAtomicLock::DefaultSpinCount, true  },
+		};
+
+		for (const FVariant& Variant : Variants)
+		{
+			FJobSystemConfig Config;
+
+			Config.WorkerCount        = 4;
+			Config.IdleSpinCount      = Variant.IdleSpinCount;
+			Config.b_HelpWhileWaiting = Variant.b_HelpWhileWaiting;
+
+			FJobSystem JobSystem(Config);
+
+			JobSystem.Startup();
+
+			MeasureRoundTrips(JobSystem, WarmupCount);
+
+			std::printf("%s\n", Variant.Name);
+
+			PrintLatencyRow("  Schedule + Await", MeasureRoundTrips(JobSystem, MeasuredCount));
+			PrintLatencyRow("  nested fan-out of 8 + Await", MeasureNestedAwaits(JobSystem, MeasuredCount / 8));
+
+			JobSystem.Shutdown();
+		}
+	}
+
+	inline void RunWakeUpBenchmark()
+	{
+		PrintTitle("Wake-up latency of an idle worker: parked, spin then park, realtime busy-poll");
+
+		constexpr size_t                    WarmupCount   = 100;
+		constexpr size_t                    MeasuredCount = 5000;
+		constexpr std::chrono::microseconds Gap(200);
+
+		std::printf("%-34s %10s %10s %10s %10s %10s\n", "", "p50 (us)", "p90 (us)", "p99 (us)", "p999 (us)", "max (us)");
+
+		auto PrintRow = [](const char* Name, std::vector<int64_t>&& Samples)
+			{
+				std::printf("%-34s %10.2f %10.2f %10.2f %10.2f %10.2f\n", Name,
+					static_cast<double>(Percentile(Samples, 0.5))   / 1e3,
+					static_cast<double>(Percentile(Samples, 0.9))   / 1e3,
+					static_cast<double>(Percentile(Samples, 0.99))  / 1e3,
+					static_cast<double>(Percentile(Samples, 0.999)) / 1e3,
+					static_cast<double>(Percentile(Samples, 1.0))   / 1e3);
+			};
+
+		struct FVariant
+		{
+			const char* Name;
+			uint32_t    IdleSpinCount;
+			bool        b_Realtime;
+		};
+
+		const FVariant Variants[] =
+		{
+			{ "parked worker",      0,                             false },
+			{ "spin then park",     FAtomicLock::DefaultSpinCount, false },
+			{ "realtime busy-poll", FAtomicLock::DefaultSpinCount, true  },
+		};
+
+		for (const FVariant& Variant : Variants)
+		{
+			FJobSystemConfig Config;
+
+			Config.WorkerCount         = 2;
+			Config.IdleSpinCount       = Variant.IdleSpinCount;
+			Config.RealtimeWorkerCount = Variant.b_Realtime ? 1 : 0;
+
+			FJobSystem JobSystem(Config);
+
+			JobSystem.Startup();
+
+			auto Submit = [&JobSystem, &Variant](auto&& Job)
+				{
+					if (Variant.b_Realtime)
+					{
+						JobSystem.ScheduleRealtime(Job);
+					}
+					else
+					{
+						JobSystem.Schedule(Job);
+					}
+				};
+
+			MeasureWakeUps(Submit, WarmupCount, Gap);
+
+			PrintRow(Variant.Name, MeasureWakeUps(Submit, MeasuredCount, Gap));
+
+			JobSystem.Shutdown();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "BenchmarkUtility.h"
+#include "../FJobSystem.h"
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	// Best of a few runs, in milliseconds.
+	template<typename Function_T>
+	double MeasureBestMilliseconds(Function_T&& Function, size_t Runs = 5)
+	{
+		double Best = 1e300;
+
+		for (size_t Run = 0; Run < Runs; ++Run)
+		{
+			FStopwatch Stopwatch;
+
+			Function();
+
+			Best = std::min(Best, Stopwatch.GetSeconds() * 1e3);
+		}
+
+		return Best;
+	}
+
+	inline void RunParallelBenchmark()
+	{
+		PrintTitle("ParallelFor / ParallelReduce vs serial loop");
+
+		FJobSystem JobSystem;
+
+		JobSystem.Startup();
+
+		std::printf("%zu workers + calling thread\n", JobSystem.GetWorkerCount());
+		std::printf("%12s %10s %12s %12s %10s\n", "Elements", "Kernel", "Serial (ms)", "Jobs (ms)", "Speedup");
+
+		for (size_t Count : { size_t(1000000), size_t(100000000) })
+		{
+			std::vector<float> Values(Count, 1.0f);
+
+			const double SerialFor = MeasureBestMilliseconds([&]()
+				{
+					for (float& Value : Values)
+					{
+						Value = Value * 0.999f + 0.001f;
+					}
+				});
+
+			const double ParallelFor = MeasureBestMilliseconds([&]()
+				{
+					JobSystem.ParallelFor<size_t>(0, Count, 0, [&](size_t Begin, size_t End)
+						{
+							for (size_t i = Begin; i < End; ++i)
+							{
+								Values[i] = Values[i] * 0.999f + 0.001f;
+							}
+						});
+				});
+
+			std::printf("%12zu %10s %12.3f %12.3f %9.2fx\n", Count, "for", SerialFor, ParallelFor, SerialFor / ParallelFor);
+
+			double SerialSum   = 0.0;
+			double ParallelSum = 0.0;
+
+			const double SerialReduce = MeasureBestMilliseconds([&]()
+				{
+					SerialSum = 0.0;
+
+					for (float Value : Values)
+					{
+						SerialSum += Value;
+					}
+				});
+
+			const double ParallelReduce = MeasureBestMilliseconds([&]()
+				{
+					ParallelSum = JobSystem.ParallelReduce(Values, 0.0, std::plus<double>());
+				});
+
+			std::printf("%12zu %10s %12.3f %12.3f %9.2fx   (sums %.1f / %.1f)\n", Count, "reduce", SerialReduce, ParallelReduce, SerialReduce / ParallelReduce, SerialSum, ParallelSum);
+		}
+
+		JobSystem.Shutdown();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "BenchmarkUtility.h"
+#include "../FJobQueue.h"
+
+#include <atomic>
+#include <deque>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	class FQueueNode : public IJob
+	{
+	public:
+
+		void Execute() override {}
+	};
+
+	// FJobQueue before the ring: an unbounded std::deque behind one mutex.
+	class FMutexJobQueue
+	{
+	public:
+
+		void Submit(Job_T&& Job)
+		{
+			std::scoped_lock<std::mutex> Lock(AccessMutex);
+
+			Jobs.push_back(std::move(Job));
+		}
+
+		bool TransferFront(Job_T& Job)
+		{
+			std::scoped_lock<std::mutex> Lock(AccessMutex);
+
+			if (Jobs.empty())
+			{
+				return false;
+			}
+
+			Job = std::move(Jobs.front());
+
+			Jobs.pop_front();
+
+			return true;
+		}
+
+	private:
+
+		std::mutex        AccessMutex;
+		std::deque<Job_T> Jobs;
+	};
+
+	// Returns transfers per second, each of ProducerCount threads submits its share while ConsumerCount threads drain.
+	template<typename Queue_T>
+	double MeasureQueue(size_t ProducerCount, size_t ConsumerCount, size_t TotalJobs)
+	{
+		const size_t JobsPerProducer = TotalJobs / ProducerCount;
+
+		// The nodes belong to the benchmark, consumers release them instead of freeing them.
+		std::vector<FQueueNode>  Nodes(JobsPerProducer * ProducerCount);
+		Queue_T                  Queue;
+		std::atomic<size_t>      Consumed = 0;
+		std::latch               StartLatch(static_cast<ptrdiff_t>(ProducerCount + ConsumerCount + 1));
+		std::vector<std::thread> Threads;
+
+		for (size_t Producer = 0; Producer < ProducerCount; ++Producer)
+		{
+			Threads.emplace_back([&, Producer]()
+				{
+					FQueueNode* First = Nodes.data() + Producer * JobsPerProducer;
+
+					StartLatch.arrive_and_wait();
+
+					for (size_t i = 0; i < JobsPerProducer; ++i)
+					{
+						Queue.Submit(Job_T(First + i));
+					}
+				});
+		}
+
+		for (size_t Consumer = 0; Consumer < ConsumerCount; ++Consumer)
+		{
+			Threads.emplace_back([&]()
+				{
+					StartLatch.arrive_and_wait();
+
+					Job_T Job;
+
+					while (Consumed.load(std::memory_order_relaxed) < Nodes.size())
+					{
+						if (Queue.TransferFront(Job))
+						{
+							Job.release();
+
+							Consumed.fetch_add(1, std::memory_order_relaxed);
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+				});
+		}
+
+		StartLatch.arrive_and_wait();
+
+		FStopwatch Stopwatch;
+
+		for (auto& Thread : Threads)
+		{
+			Thread.join();
+		}
+
+		return static_cast<double>(Nodes.size()) / Stopwatch.GetSeconds();
+	}
+
+	inline void RunQueueBenchmark()
+	{
+		PrintTitle("Priority queue: deque + mutex vs bounded MPMC ring");
+
+		constexpr size_t TotalJobs = 1 << 21;
+
+		struct FRatio
+		{
+			size_t Producers;
+			size_t Consumers;
+		};
+
+		constexpr FRatio Ratios[] = { { 1, 1 }, { 1, 4 }, { 4, 1 }, { 2, 2 }, { 4, 4 }, { 8, 2 }, { 2, 8 }, { 8, 8 } };
+
+		std::printf("%10s %10s %18s %18s %10s\n", "Producers", "Consumers", "Mutex (Mjob/s)", "Ring (Mjob/s)", "Speedup");
+
+		for (const FRatio& Ratio : Ratios)
+		{
+			const double Mutex = MeasureQueue<FMutexJobQueue>(Ratio.Producers, Ratio.Consumers, TotalJobs);
+			const double Ring  = MeasureQueue<FJobQueue>(Ratio.Producers, Ratio.Consumers, TotalJobs);
+
+			std::printf("%10zu %10zu %18.2f %18.2f %9.2fx\n", Ratio.Producers, Ratio.Consumers, Mutex / 1e6, Ring / 1e6, Ring / Mutex);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "BenchmarkUtility.h"
+#include "BenchmarkBackends.h"
+
+#include <algorithm>
+#include <atomic>
+#include <latch>
+#include <thread>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	// Samples are the nanoseconds one operation of the workload took, JobCount counts the jobs of all of them.
+	struct FWorkloadResult
+	{
+		std::vector<int64_t> Samples;
+		size_t               JobCount = 0;
+		double               Seconds  = 0.0;
+	};
+
+	// Op: one empty job, scheduled and awaited before the next one.
+	template<typename Backend_T>
+	FWorkloadResult MeasureRoundTrip(Backend_T& Backend)
+	{
+		constexpr size_t OperationCount = 2000;
+
+		FWorkloadResult Result;
+
+		FStopwatch Total;
+
+		for (size_t i = 0; i < OperationCount; ++i)
+		{
+			FStopwatch Stopwatch;
+
+			Backend.Wait(Backend.Run([]() {}));
+
+			Result.Samples.push_back(Stopwatch.GetNanoseconds());
+		}
+
+		Result.Seconds  = Total.GetSeconds();
+		Result.JobCount = OperationCount;
+
+		return Result;
+	}
+
+	// Op: a burst of empty jobs, all scheduled before any is awaited.
+	template<typename Backend_T>
+	FWorkloadResult MeasureEmptyJobs(Backend_T& Backend)
+	{
+		constexpr size_t OperationCount = 20;
+		constexpr size_t BurstSize      = 1000;
+
+		FWorkloadResult Result;
+
+		std::vector<typename Backend_T::Handle_T> Handles(BurstSize);
+
+		FStopwatch Total;
+
+		for (size_t i = 0; i < OperationCount; ++i)
+		{
+			FStopwatch Stopwatch;
+
+			for (auto& Handle : Handles)
+			{
+				Handle = Backend.Run([]() {});
+			}
+
+			for (auto& Handle : Handles)
+			{
+				Backend.Wait(Handle);
+			}
+
+			Result.Samples.push_back(Stopwatch.GetNanoseconds());
+		}
+
+		Result.Seconds  = Total.GetSeconds();
+		Result.JobCount = OperationCount * BurstSize;
+
+		return Result;
+	}
+
+	// Op: fan out jobs with a bit of work each, then join on all of them.
+	template<typename Backend_T>
+	FWorkloadResult MeasureFanOutFanIn(Backend_T& Backend)
+	{
+		constexpr size_t OperationCount = 100;
+		constexpr size_t FanOut         = 64;
+
+		FWorkloadResult Result;
+
+		std::vector<typename Backend_T::Handle_T> Handles(FanOut);
+		std::atomic<uint64_t>                     Sink = 0;
+
+		FStopwatch Total;
+
+		for (size_t i = 0; i < OperationCount; ++i)
+		{
+			FStopwatch Stopwatch;
+
+			for (size_t Job = 0; Job < FanOut; ++Job)
+			{
+				Handles[Job] = Backend.Run([&Sink, Job]()
+					{
+						uint64_t Value = Job;
+
+						for (uint32_t Step = 0; Step < 2000; ++Step)
+						{
+							Value = Value * 6364136223846793005ull + 1442695040888963407ull;
+						}
+
+						Sink.fetch_add(Value, std::memory_order_relaxed);
+					});
+			}
+
+			for (auto& Handle : Handles)
+			{
+				Backend.Wait(Handle);
+			}
+
+			Result.Samples.push_back(Stopwatch.GetNanoseconds());
+		}
+
+		Result.Seconds  = Total.GetSeconds();
+		Result.JobCount = OperationCount * FanOut;
+
+		return Result;
+	}
+
+	// Op: a chain of empty jobs, each one depending on the previous one.
+	template<typename Backend_T>
+	FWorkloadResult MeasureDependencyChain(Backend_T& Backend)
+	{
+		constexpr size_t OperationCount = 20;
+		constexpr size_t Depth          = 256;
+
+		FWorkloadResult Result;
+
+		FStopwatch Total;
+
+		for (size_t i = 0; i < OperationCount; ++i)
+		{
+			FStopwatch Stopwatch;
+
+			typename Backend_T::Handle_T Handle = Backend.Run([]() {});
+
+			for (size_t Link = 1; Link < Depth; ++Link)
+			{
+				Handle = Backend.RunAfter(Handle, []() {});
+			}
+
+			Backend.Wait(Handle);
+
+			Result.Samples.push_back(Stopwatch.GetNanoseconds());
+		}
+
+		Result.Seconds  = Total.GetSeconds();
+		Result.JobCount = OperationCount * Depth;
+
+		return Result;
+	}
+
+	// Op: one empty job from submission to completion, with several threads submitting at once.
+	template<typename Backend_T>
+	FWorkloadResult MeasureManyProducers(Backend_T& Backend)
+	{
+		constexpr size_t ProducerCount   = 8;
+		constexpr size_t JobsPerProducer = 500;
+
+		FWorkloadResult Result;
+
+		std::vector<std::vector<int64_t>> Samples(ProducerCount);
+		std::vector<std::thread>          Producers;
+		std::latch                        StartLatch(static_cast<ptrdiff_t>(ProducerCount + 1));
+
+		for (size_t Producer = 0; Producer < ProducerCount; ++Producer)
+		{
+			Producers.emplace_back([&, Producer]()
+				{
+					std::vector<typename Backend_T::Handle_T> Handles;
+					std::vector<FStopwatch>                   Stopwatches(JobsPerProducer);
+
+					Handles.reserve(JobsPerProducer);
+
+					StartLatch.arrive_and_wait();
+
+					for (size_t i = 0; i < JobsPerProducer; ++i)
+					{
+						Stopwatches[i].Reset();
+
+						Handles.push_back(Backend.Run([]() {}));
+					}
+
+					for (size_t i = 0; i < JobsPerProducer; ++i)
+					{
+						Backend.Wait(Handles[i]);
+
+						Samples[Producer].push_back(Stopwatches[i].GetNanoseconds());
+					}
+				});
+		}
+
+		StartLatch.arrive_and_wait();
+
+		FStopwatch Total;
+
+		for (auto& Thread : Producers)
+		{
+			Thread.join();
+		}
+
+		Result.Seconds  = Total.GetSeconds();
+		Result.JobCount = ProducerCount * JobsPerProducer;
+
+		for (auto& ProducerSamples : Samples)
+		{
+			Result.Samples.insert(Result.Samples.end(), ProducerSamples.begin(), ProducerSamples.end());
+		}
+
+		return Result;
+	}
+
+	inline void PrintWorkloadRow(const char* Backend, const char* Workers, FWorkloadResult&& Result)
+	{
+		std::printf("%-12s %8s %12.3f %12.2f %12.2f %12.2f\n", Backend, Workers,
+			static_cast<double>(Result.JobCount) / Result.Seconds / 1e6,
+			static_cast<double>(Percentile(Result.Samples, 0.5))   / 1e3,
+			static_cast<double>(Percentile(Result.Samples, 0.99))  / 1e3,
+			static_cast<double>(Percentile(Result.Samples, 0.999)) / 1e3);
+	}
+
+	// 1, 2, 4, ... up to the core count, which is always included.
+	inline std::vector<size_t> GetWorkerCounts()
+	{
+		const size_t CoreCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		std::vector<size_t> Counts;
+
+		for (size_t Count = 1; Count < CoreCount; Count *= 2)
+		{
+			Counts.push_back(Count);
+		}
+
+		Counts.push_back(CoreCount);
+
+		return Counts;
+	}
+
+	template<typename Backend_T, typename Workload_T>
+	void RunWorkload(const std::vector<size_t>& WorkerCounts, Workload_T& Workload)
+	{
+		char Workers[16];
+
+		for (size_t WorkerCount : WorkerCounts)
+		{
+			Backend_T Backend(WorkerCount);
+
+			// Zero stands for a backend without a fixed set of workers.
+			std::snprintf(Workers, sizeof(Workers), WorkerCount ? "%zu" : "-", WorkerCount);
+
+			PrintWorkloadRow(Backend_T::Name, Workers, Workload(Backend));
+		}
+	}
+
+	inline void RunScalabilityBenchmark()
+	{
+		PrintTitle("Scalability: FJobSystem vs plain thread pool vs std::async");
+
+		const std::vector<size_t> WorkerCounts = GetWorkerCounts();
+
+		auto RunBackends = [&WorkerCounts](const char* Name, const char* Operation, auto&& Workload)
+			{
+				std::printf("\n%s (op = %s)\n", Name, Operation);
+				std::printf("%-12s %8s %12s %12s %12s %12s\n", "Backend", "Workers", "Mjobs/s", "p50 op (us)", "p99 op (us)", "p999 op (us)");
+
+				RunWorkload<FJobSystemBackend>(WorkerCounts, Workload);
+				RunWorkload<FThreadPoolBackend>(WorkerCounts, Workload);
+				RunWorkload<FAsyncBackend>({ 0 }, Workload);
+			};
+
+		RunBackends("Await round trip", "one job",                 [](auto& Backend) { return MeasureRoundTrip(Backend); });
+		RunBackends("Empty jobs",       "burst of 1000 jobs",      [](auto& Backend) { return MeasureEmptyJobs(Backend); });
+		RunBackends("Fan-out/fan-in",   "64 jobs and the join",    [](auto& Backend) { return MeasureFanOutFanIn(Backend); });
+		RunBackends("Dependency chain", "chain of 256 jobs",       [](auto& Backend) { return MeasureDependencyChain(Backend); });
+		RunBackends("8 producers",      "one job, submit to done", [](auto& Backend) { return MeasureManyProducers(Backend); });
+	}
+}
\ No newline at end of file
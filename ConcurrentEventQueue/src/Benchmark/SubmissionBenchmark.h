@@ -0,0 +1,143 @@
+#pragma once
+
+#include "BenchmarkUtility.h"
+#include "../TIntrusiveMpscQueue.h"
+
+#include <atomic>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace t3d::benchmark
+{
+	struct FSubmissionNode
+	{
+		FSubmissionNode* Next = nullptr;
+	};
+
+	// The WriteBuffer path FWorkerThread used before the lock-free queue: push under a mutex, swap under the same mutex.
+	class FMutexSubmission
+	{
+	public:
+
+		void Push(FSubmissionNode* Node)
+		{
+			std::scoped_lock<std::mutex> Lock(BufferMutex);
+
+			WriteBuffer.push_back(Node);
+		}
+
+		size_t Drain(std::vector<FSubmissionNode*>& ReadBuffer)
+		{
+			{
+				std::scoped_lock<std::mutex> Lock(BufferMutex);
+
+				std::swap(ReadBuffer, WriteBuffer);
+			}
+
+			const size_t Count = ReadBuffer.size();
+
+			ReadBuffer.clear();
+
+			return Count;
+		}
+
+	private:
+
+		std::mutex                    BufferMutex;
+		std::vector<FSubmissionNode*> WriteBuffer;
+	};
+
+	class FLockFreeSubmission
+	{
+	public:
+
+		void Push(FSubmissionNode* Node)
+		{
+			Queue.Push(Node);
+		}
+
+		size_t Drain(std::vector<FSubmissionNode*>&)
+		{
+			size_t Count = 0;
+
+			for (FSubmissionNode* Node = Queue.TakeAll(); Node; Node = Node->Next)
+			{
+				++Count;
+			}
+
+			return Count;
+		}
+
+	private:
+
+		TIntrusiveMpscQueue<FSubmissionNode, &FSubmissionNode::Next> Queue;
+	};
+
+	// Returns pushes per second with ProducerCount threads feeding one draining consumer.
+	template<typename Submission_T>
+	double MeasureSubmission(size_t ProducerCount, size_t TotalPushes)
+	{
+		const size_t PushesPerProducer = TotalPushes / ProducerCount;
+
+		std::vector<FSubmissionNode> Nodes(PushesPerProducer * ProducerCount);
+		Submission_T                 Submission;
+		std::latch                   StartLatch(static_cast<ptrdiff_t>(ProducerCount + 1));
+		std::vector<std::thread>     Producers;
+
+		for (size_t Producer = 0; Producer < ProducerCount; ++Producer)
+		{
+			Producers.emplace_back([&, Producer]()
+				{
+					FSubmissionNode* First = Nodes.data() + Producer * PushesPerProducer;
+
+					StartLatch.arrive_and_wait();
+
+					for (size_t i = 0; i < PushesPerProducer; ++i)
+					{
+						Submission.Push(First + i);
+					}
+				});
+		}
+
+		std::vector<FSubmissionNode*> ReadBuffer;
+
+		StartLatch.arrive_and_wait();
+
+		FStopwatch Stopwatch;
+
+		size_t Drained = 0;
+
+		while (Drained < Nodes.size())
+		{
+			Drained += Submission.Drain(ReadBuffer);
+		}
+
+		const double Seconds = Stopwatch.GetSeconds();
+
+		for (auto& Thread : Producers)
+		{
+			Thread.join();
+		}
+
+		return static_cast<double>(Nodes.size()) / Seconds;
+	}
+
+	inline void RunSubmissionBenchmark()
+	{
+		PrintTitle("Worker submission: mutex + vector swap vs intrusive MPSC");
+
+		constexpr size_t TotalPushes = 1 << 22;
+
+		std::printf("%10s %18s %18s %10s\n", "Producers", "Mutex (Mpush/s)", "MPSC (Mpush/s)", "Speedup");
+
+		for (size_t Producers = 1; Producers <= 64; Producers *= 2)
+		{
+			const double Mutex    = MeasureSubmission<FMutexSubmission>(Producers, TotalPushes);
+			const double LockFree = MeasureSubmission<FLockFreeSubmission>(Producers, TotalPushes);
+
+			std::printf("%10zu %18.2f %18.2f %9.2fx\n", Producers, Mutex / 1e6, LockFree / 1e6, LockFree / Mutex);
+		}
+	}
+}
@@ -0,0 +1,50 @@
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+
+#include "SubmissionBenchmark.h"
+#include "AllocationBenchmark.h"
+#include "ParallelBenchmark.h"
+#include "BatchBenchmark.h"
+#include "LatencyBenchmark.h"
+#include "ScalabilityBenchmark.h"
+#include "QueueBenchmark.h"
+
+struct FBenchmarkEntry
+{
+	const char* Name;
+	void      (*Run)();
+};
+
+static const FBenchmarkEntry Benchmarks[] =
+{
+	{ "submission", &t3d::benchmark::RunSubmissionBenchmark  },
+	{ "allocation", &t3d::benchmark::RunAllocationBenchmark  },
+	{ "parallel",   &t3d::benchmark::RunParallelBenchmark    },
+	{ "batch",      &t3d::benchmark::RunBatchBenchmark       },
+	{ "latency",    &t3d::benchmark::RunLatencyBenchmark     },
+	{ "wakeup",     &t3d::benchmark::RunWakeUpBenchmark      },
+	{ "scaling",    &t3d::benchmark::RunScalabilityBenchmark },
+	{ "queue",      &t3d::benchmark::RunQueueBenchmark       },
+};
+
+int32_t main(int32_t ArgC, char* ArgV[])
+{
+	// No arguments runs everything, otherwise only the named benchmarks.
+	for (const FBenchmarkEntry& Entry : Benchmarks)
+	{
+		bool b_Selected = ArgC < 2;
+
+		for (int32_t i = 1; i < ArgC; ++i)
+		{
+			b_Selected |= std::strcmp(ArgV[i], Entry.Name) == 0;
+		}
+
+		if (b_Selected)
+		{
+			Entry.Run();
+		}
+	}
+
+	return 0;
+}
\ No newline at end of file
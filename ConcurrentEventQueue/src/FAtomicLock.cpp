@@ -18,8 +18,13 @@ namespace t3d
 		b_Released.notify_one();
 	}
 
-	void FAtomicLock::Acquire()
+	void FAtomicLock::Acquire(uint32_t SpinCount)
 	{
+		for (uint32_t Spin = 0; Spin < SpinCount && !b_Released.load(std::memory_order_relaxed); ++Spin)
+		{
+			CpuRelax();
+		}
+
 		b_Released.wait(false);
 
 		b_Released.store(false);
@@ -1,13 +1,31 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+
+#if defined _M_X64 || defined _M_IX86 || defined __x86_64__ || defined __i386__
+#include <immintrin.h>
+#endif
 
 namespace t3d
 {
+	// Tells the core we are in a spin-wait loop: saves power and frees the pipeline for the sibling hyper-thread.
+	inline void CpuRelax()
+	{
+#if defined _M_X64 || defined _M_IX86 || defined __x86_64__ || defined __i386__
+		_mm_pause();
+#elif defined __aarch64__ || defined __arm__
+		__asm__ __volatile__("yield");
+#endif
+	}
+
 	class FAtomicLock
 	{
 	public:
 
+		// Roughly a few microseconds of pause instructions, about the cost of a futex sleep and wake.
+		static constexpr uint32_t DefaultSpinCount = 1024;
+
 	// Constructors and Destructor:
 
 		 FAtomicLock ();
@@ -16,7 +34,9 @@ namespace t3d
 	// Functions:
 
 		void Release ();
-		void Acquire ();
+
+		// Spins up to SpinCount times before parking the thread, 0 parks right away.
+		void Acquire (uint32_t SpinCount = DefaultSpinCount);
 
 	private:
 
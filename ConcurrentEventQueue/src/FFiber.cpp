@@ -0,0 +1,143 @@
+#include "FFiber.h"
+#include "FWorkerThread.h"
+
+#include <cassert>
+
+#if defined _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FFiber::FFiber(FWorkerThread* InOwner, size_t StackSize)
+		: Owner (InOwner)
+	{
+#if defined _WIN32
+		// The system reserves fiber stacks with a guard page of their own.
+		Context       = CreateFiber(StackSize, &FFiber::Entry, this);
+		CallerContext = nullptr;
+
+		assert(Context && "Failed to create fiber!");
+#else
+		const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+		StackSize    = (StackSize + PageSize - 1) / PageSize * PageSize;
+		StackMapSize = StackSize + PageSize;
+
+		void* Memory = mmap(nullptr, StackMapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		assert(Memory != MAP_FAILED && "Failed to map fiber stack!");
+
+		Stack = static_cast<std::byte*>(Memory);
+
+		// Stacks grow down, the guard goes at the lowest address.
+		const int Protected = mprotect(Stack, PageSize, PROT_NONE);
+
+		assert(Protected == 0 && "Failed to protect fiber stack guard page!");
+
+		(void)Protected;
+
+		getcontext(&Context);
+
+		Context.uc_stack.ss_sp   = Stack + PageSize;
+		Context.uc_stack.ss_size = StackSize;
+		Context.uc_link          = nullptr;
+
+		// makecontext only passes ints along.
+		const uintptr_t Address = reinterpret_cast<uintptr_t>(this);
+
+		makecontext(&Context, reinterpret_cast<void (*)()>(&FFiber::Entry), 2, static_cast<uint32_t>(uint64_t(Address) >> 32), static_cast<uint32_t>(Address));
+#endif
+	}
+
+	FFiber::~FFiber()
+	{
+		assert(!Job && "Fiber destroyed while its job is parked!");
+
+#if defined _WIN32
+		DeleteFiber(Context);
+#else
+		munmap(Stack, StackMapSize);
+#endif
+	}
+
+
+// Functions:
+
+	void FFiber::Resume()
+	{
+#if defined _WIN32
+		CallerContext = GetCurrentFiber();
+
+		SwitchToFiber(Context);
+#else
+		swapcontext(&CallerContext, &Context);
+#endif
+	}
+
+	void FFiber::Suspend()
+	{
+#if defined _WIN32
+		SwitchToFiber(CallerContext);
+#else
+		swapcontext(&Context, &CallerContext);
+#endif
+	}
+
+	void FFiber::Continue()
+	{
+		Owner->ResumeFiber(this);
+	}
+
+	void FFiber::ConvertThread()
+	{
+#if defined _WIN32
+		ConvertThreadToFiber(nullptr);
+#endif
+	}
+
+	void FFiber::RevertThread()
+	{
+#if defined _WIN32
+		ConvertFiberToThread();
+#endif
+	}
+
+
+// Private Functions:
+
+	void FFiber::Run()
+	{
+		// Fibers are reused, every pass runs one job.
+		for (;;)
+		{
+			Job->Execute();
+
+			b_Finished = true;
+
+			this->Suspend();
+		}
+	}
+
+#if defined _WIN32
+	void __stdcall FFiber::Entry(void* Parameter)
+	{
+		static_cast<FFiber*>(Parameter)->Run();
+	}
+#else
+	void FFiber::Entry(uint32_t AddressHigh, uint32_t AddressLow)
+	{
+		const uintptr_t Address = static_cast<uintptr_t>((uint64_t(AddressHigh) << 32) | AddressLow);
+
+		reinterpret_cast<FFiber*>(Address)->Run();
+	}
+#endif
+
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "IJob.h"
+#include "IJobContinuation.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined _WIN32
+#include <ucontext.h>
+#endif
+
+namespace t3d
+{
+	class FWorkerThread;
+	class FJobHandleBase;
+
+	// A user-mode stack a job runs on, so that it can park in Await and let its worker move on.
+	// Windows fibers on Windows, ucontext everywhere else. A fiber only ever runs on the worker that owns it.
+	// Below each stack sits a guard page, so an overflow faults right away instead of corrupting whatever lies next to it.
+	class FFiber : public IJobContinuation
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		 FFiber (FWorkerThread* InOwner, size_t StackSize);
+		~FFiber ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// Runs the fiber on the calling thread until its job finishes or parks.
+		void Resume  ();
+
+		// From inside the fiber: back to whoever resumed it.
+		void Suspend ();
+
+		// The handle the fiber parked on has signaled.
+		void Continue () override;
+
+		// Windows needs the worker thread itself to be a fiber before it can switch to one.
+		static void ConvertThread ();
+		static void RevertThread  ();
+
+	// Variables:
+
+		// Set while a job is assigned, cleared by the worker once the fiber reports it finished.
+		Job_T           Job;
+		bool            b_Finished = false;
+		int64_t         StartTime  = 0;
+
+		// The handle the job waits on, the worker registers the fiber with it after switching out.
+		FJobHandleBase* WaitingOn  = nullptr;
+
+		// Intrusive link for the owner's ready queue.
+		FFiber*         NextFiber  = nullptr;
+
+	private:
+
+	// Private Functions:
+
+		void Run();
+
+#if defined _WIN32
+		static void __stdcall Entry (void* Parameter);
+#else
+		static void           Entry (uint32_t AddressHigh, uint32_t AddressLow);
+#endif
+
+	// Variables:
+
+		FWorkerThread*               Owner;
+
+#if defined _WIN32
+		void*                        Context;
+		void*                        CallerContext;
+#else
+		// Mapping of the stack and its guard page.
+		std::byte*                   Stack;
+		size_t                       StackMapSize;
+		ucontext_t                   Context;
+		ucontext_t                   CallerContext;
+#endif
+	};
+
+//	constexpr size_t Size = sizeof(FFiber);
+}
\ No newline at end of file
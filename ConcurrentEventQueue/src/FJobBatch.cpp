@@ -0,0 +1,99 @@
+#include "FJobBatch.h"
+#include "FJobSystem.h"
+
+#include <cassert>
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FJobBatch::FJobBatch(FJobSystem& InJobSystem, EJobPriority InPriority)
+		: JobSystem (InJobSystem)
+		, Pool      (InJobSystem.GetJobPool())
+		, Priority  (InPriority)
+	{}
+
+	FJobBatch::~FJobBatch()
+	{
+		if (!Jobs.empty())
+		{
+			this->Submit();
+		}
+	}
+
+
+// Functions:
+
+	void FJobBatch::Reserve(size_t Count)
+	{
+		Jobs.reserve(Count);
+		Handles.reserve(Count);
+	}
+
+	JobHandle_T<void> FJobBatch::Submit()
+	{
+		if (Jobs.empty())
+		{
+			JobHandle_T<void> Done = MakeJobHandle<void>();
+
+			Done->Signal();
+
+			return Done;
+		}
+
+		FCompletion* Completion = new FCompletion(Jobs.size());
+
+		JobHandle_T<void> Handle = Completion->Handle;
+
+		// Nothing is published yet, so every handle still takes the continuation.
+		for (size_t i = 0; i < Handles.size(); ++i)
+		{
+			Completion->Links[i].Owner = Completion;
+
+			const bool b_Added = Handles[i]->AddContinuation(&Completion->Links[i]);
+
+			assert(b_Added && "Batched job ran before its batch was submitted!");
+
+			(void)b_Added;
+		}
+
+		JobSystem.SubmitBatch(Jobs.data(), Jobs.size(), Priority);
+
+		Jobs.clear();
+		Handles.clear();
+
+		return Handle;
+	}
+
+
+// Accessors:
+
+	size_t FJobBatch::GetCount() const
+	{
+		return Jobs.size();
+	}
+
+
+// FCompletion:
+
+	FJobBatch::FCompletion::FCompletion(size_t Count)
+		: Pending (Count)
+		, Links   (new FLink[Count])
+		, Handle  (MakeJobHandle<void>())
+	{}
+
+	void FJobBatch::FCompletion::Arrive()
+	{
+		if (Pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		{
+			return;
+		}
+
+		JobHandle_T<void> Done = std::move(Handle);
+
+		delete this;
+
+		Done->Signal();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "TJob.h"
+#include "FJobQueue.h"
+#include "IJobContinuation.h"
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace t3d
+{
+	class FJobSystem;
+
+	// Collects jobs and publishes them all at once: one queue operation and one wake-up per worker instead of one per job.
+	// Jobs don't run before Submit(), anything still collected when the batch dies is submitted then.
+	class FJobBatch
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		explicit FJobBatch (FJobSystem& InJobSystem, EJobPriority InPriority = EJobPriority::Normal);
+		        ~FJobBatch ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		template<typename Functor_T>
+		JobHandle_T<std::invoke_result_t<Functor_T>> Add(Functor_T&& Job, const char* Name = nullptr)
+		{
+			using Return_T = std::invoke_result_t<Functor_T>;
+
+			auto* InternalJob = TJob<Return_T, std::decay_t<Functor_T>>::Create(Pool, std::forward<Functor_T>(Job));
+
+			JobHandle_T<Return_T> Handle = InternalJob->GetHandle();
+
+			InternalJob->Name = Name;
+
+			Jobs.push_back(InternalJob);
+			Handles.push_back(Handle.get());
+
+			return Handle;
+		}
+
+		void Reserve(size_t Count);
+
+		// The returned handle signals once every job of the batch is done.
+		JobHandle_T<void> Submit();
+
+	// Accessors:
+
+		size_t GetCount() const;
+
+	private:
+
+		// Counts the jobs of a submitted batch down, frees itself after signaling the combined handle.
+		class FCompletion
+		{
+		public:
+
+			explicit FCompletion(size_t Count);
+
+			void Arrive();
+
+			class FLink : public IJobContinuation
+			{
+			public:
+
+				void Continue() override
+				{
+					Owner->Arrive();
+				}
+
+				FCompletion* Owner = nullptr;
+			};
+
+			std::atomic<size_t>      Pending;
+			std::unique_ptr<FLink[]> Links;
+			JobHandle_T<void>        Handle;
+		};
+
+	// Variables:
+
+		FJobSystem&                  JobSystem;
+		FSlabPool&                   Pool;
+		EJobPriority                 Priority;
+		std::vector<IJob*>           Jobs;
+		std::vector<FJobHandleBase*> Handles;
+	};
+
+//	constexpr size_t Size = sizeof(FJobBatch);
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "FJobCounter.h"
+
+#include <cassert>
+#include <thread>
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FJobCounter::FJobCounter(uint32_t InitialValue)
+		: Value            (InitialValue)
+		, ActiveDecrements (0)
+		, WaiterCount      (0)
+		, Waiters          (nullptr)
+	{}
+
+	FJobCounter::~FJobCounter()
+	{
+		// The job that took the counter to zero may still be on its way out of Decrement.
+		while (ActiveDecrements.load(std::memory_order_acquire) != 0)
+		{
+			std::this_thread::yield();
+		}
+
+		assert(!Waiters && "Counter destroyed while something still waits on it!");
+	}
+
+
+// Functions:
+
+	void FJobCounter::Increment(uint32_t Count)
+	{
+		Value.fetch_add(Count, std::memory_order_relaxed);
+	}
+
+	void FJobCounter::Decrement(uint32_t Count)
+	{
+		ActiveDecrements.fetch_add(1, std::memory_order_relaxed);
+
+		// Sequentially consistent together with When(): either this sees the new waiter or the waiter sees the new value.
+		const uint32_t Previous = Value.fetch_sub(Count, std::memory_order_seq_cst);
+
+		assert(Previous >= Count && "Counter dropped below zero!");
+
+		if (WaiterCount.load(std::memory_order_seq_cst) == 0)
+		{
+			ActiveDecrements.fetch_sub(1, std::memory_order_release);
+
+			return;
+		}
+
+		const uint32_t Reached = Previous - Count;
+
+		FWaiter* Released = nullptr;
+
+		{
+			std::scoped_lock<std::mutex> Lock(WaiterMutex);
+
+			uint32_t Remaining = 0;
+
+			for (FWaiter** Link = &Waiters; *Link;)
+			{
+				FWaiter* Waiter = *Link;
+
+				if (Waiter->Target < Reached)
+				{
+					Link = &Waiter->NextWaiter;
+
+					++Remaining;
+
+					continue;
+				}
+
+				*Link = Waiter->NextWaiter;
+
+				Waiter->NextWaiter = Released;
+				Released           = Waiter;
+			}
+
+			WaiterCount.store(Remaining, std::memory_order_relaxed);
+		}
+
+		ActiveDecrements.fetch_sub(1, std::memory_order_release);
+
+		// Outside the lock, a continuation may submit a job that runs inline and counts down right away.
+		// The waiters are unlinked and hold their own handle references, so the counter may already be gone.
+		while (Released)
+		{
+			FWaiter* Waiter = Released;
+
+			Released = Waiter->NextWaiter;
+
+			Waiter->Handle->Signal();
+
+			delete Waiter;
+		}
+	}
+
+	JobHandle_T<void> FJobCounter::When(uint32_t Target)
+	{
+		JobHandle_T<void> Handle = MakeJobHandle<void>();
+
+		if (this->IsDone(Target))
+		{
+			Handle->Signal();
+
+			return Handle;
+		}
+
+		FWaiter* Waiter = new FWaiter{ Target, Handle, nullptr };
+
+		{
+			std::scoped_lock<std::mutex> Lock(WaiterMutex);
+
+			Waiter->NextWaiter = Waiters;
+			Waiters            = Waiter;
+
+			WaiterCount.fetch_add(1, std::memory_order_seq_cst);
+
+			if (Value.load(std::memory_order_seq_cst) > Target)
+			{
+				return Handle;
+			}
+
+			// The last decrement may have missed the new waiter, so it's up to us. Still at the front, we hold the lock.
+			Waiters = Waiter->NextWaiter;
+
+			WaiterCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		delete Waiter;
+
+		Handle->Signal();
+
+		return Handle;
+	}
+
+	void FJobCounter::Wait(uint32_t Target)
+	{
+		if (this->IsDone(Target))
+		{
+			return;
+		}
+
+		this->When(Target)->Wait();
+	}
+
+
+// Accessors:
+
+	uint32_t FJobCounter::GetValue() const
+	{
+		return Value.load(std::memory_order_acquire);
+	}
+
+	bool FJobCounter::IsDone(uint32_t Target) const
+	{
+		return Value.load(std::memory_order_acquire) <= Target;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "TJobHandle.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace t3d
+{
+	// Wait group for many jobs at once: every job scheduled against the counter adds one and takes it away again
+	// once it's done, no job gets a handle of its own. Only waiting creates a handle, one per wait instead of one per job.
+	class FJobCounter
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		explicit FJobCounter (uint32_t InitialValue = 0);
+		        ~FJobCounter ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		void Increment (uint32_t Count = 1);
+
+		// Releases every wait whose target the counter has dropped to.
+		void Decrement (uint32_t Count = 1);
+
+		// Signals once the counter has dropped to Target or below. Pass it to FJobSystem::Schedule as a prerequisite
+		// to make a job depend on the counter, no worker blocks until then.
+		JobHandle_T<void> When(uint32_t Target = 0);
+
+		// Parks the calling fiber or helps while waiting just like FJobHandleBase::Wait.
+		void Wait(uint32_t Target = 0);
+
+	// Accessors:
+
+		uint32_t GetValue () const;
+		bool     IsDone   (uint32_t Target = 0) const;
+
+	private:
+
+		struct FWaiter
+		{
+			uint32_t          Target;
+			JobHandle_T<void> Handle;
+			FWaiter*          NextWaiter;
+		};
+
+	// Variables:
+
+		std::atomic<uint32_t> Value;
+
+		// Decrements past their update of Value, the destructor waits them out.
+		std::atomic<uint32_t> ActiveDecrements;
+
+		// Lets Decrement skip the lock while nobody waits.
+		std::atomic<uint32_t> WaiterCount;
+		std::mutex            WaiterMutex;
+
+		// Intrusive, so Decrement unlinks the released waiters under the lock and signals them after without allocating.
+		FWaiter*              Waiters;
+	};
+
+//	constexpr size_t Size = sizeof(FJobCounter);
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "FJobGate.h"
+#include "FJobSystem.h"
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FJobGate::FJobGate(FJobSystem* InJobSystem, IJob* InJob, uint32_t PrerequisiteCount)
+		: JobSystem   (InJobSystem)
+		, Job         (InJob)
+		, Pending     (PrerequisiteCount + 1)
+		, b_Cancelled (false)
+	{}
+
+
+// Functions:
+
+	void FJobGate::Arrive(const FJobHandleBase* Prerequisite)
+	{
+		if (Prerequisite && Prerequisite->IsCancelled())
+		{
+			b_Cancelled.store(true, std::memory_order_relaxed);
+		}
+
+		if (Pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		{
+			return;
+		}
+
+		FJobSystem* Target = JobSystem;
+		IJob*       Ready  = Job;
+
+		if (b_Cancelled.load(std::memory_order_relaxed))
+		{
+			Ready->Cancel();
+		}
+
+		this->~FJobGate();
+
+		FSlabPool::Free(this);
+
+		Target->Submit(Job_T(Ready));
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "IJob.h"
+#include "IJobContinuation.h"
+#include "TJobHandle.h"
+#include "FSlabPool.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+namespace t3d
+{
+	class FJobSystem;
+
+	// Holds a job back until all of its prerequisites have signaled, then submits it to the job system.
+	class FJobGate
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		         FJobGate (FJobSystem* InJobSystem, IJob* InJob, uint32_t PrerequisiteCount);
+		virtual ~FJobGate () = default;
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// Called once per prerequisite plus once by the scheduling thread. The last arrival opens the gate.
+		// A cancelled prerequisite cancels the gated job as well, it still runs through so its own dependents get released.
+		void Arrive (const FJobHandleBase* Prerequisite = nullptr);
+
+	protected:
+
+		class FLink : public IJobContinuation
+		{
+		public:
+
+			void Continue() override
+			{
+				Gate->Arrive(Prerequisite);
+			}
+
+			FJobGate*             Gate         = nullptr;
+			const FJobHandleBase* Prerequisite = nullptr;
+		};
+
+	private:
+
+	// Variables:
+
+		FJobSystem*           JobSystem;
+		IJob*                 Job;
+		std::atomic<uint32_t> Pending;
+		std::atomic<bool>     b_Cancelled;
+	};
+
+	template<size_t Count>
+	class TJobGate : public FJobGate
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		TJobGate(FJobSystem* InJobSystem, IJob* InJob)
+			: FJobGate (InJobSystem, InJob, Count)
+		{}
+
+		static TJobGate* Create(FSlabPool& Pool, FJobSystem* InJobSystem, IJob* InJob)
+		{
+			return new (Pool.Allocate(sizeof(TJobGate))) TJobGate(InJobSystem, InJob);
+		}
+
+	// Functions:
+
+		// The gate may be gone by the time this returns.
+		void Wait(const std::array<FJobHandleBase*, Count>& Prerequisites)
+		{
+			for (size_t i = 0; i < Count; ++i)
+			{
+				Links[i].Gate         = this;
+				Links[i].Prerequisite = Prerequisites[i];
+
+				if (!Prerequisites[i]->AddContinuation(&Links[i]))
+				{
+					this->Arrive(Prerequisites[i]);
+				}
+			}
+
+			this->Arrive();
+		}
+
+	private:
+
+	// Variables:
+
+		std::array<FLink, Count> Links;
+	};
+}
\ No newline at end of file
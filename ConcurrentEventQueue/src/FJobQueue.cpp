@@ -1,42 +1,156 @@
 #include "FJobQueue.h"
 
+#include <bit>
+#include <cassert>
+
 namespace t3d
 {
-	void FJobQueue::Submit(JobPointer_T&& Job)
+	FJobQueue::FJobQueue(size_t InCapacity)
+		: Mask                (std::bit_ceil(InCapacity < 2 ? size_t(2) : InCapacity) - 1)
+		, Cells               (new FCell[Mask + 1])
+		, EnqueuePosition     (0)
+		, DequeuePosition     (0)
+		, FullWaitNanoseconds (0)
+	{
+		// A slot is free for the producer at position P while its sequence is P.
+		for (size_t i = 0; i <= Mask; ++i)
+		{
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	FJobQueue::~FJobQueue()
 	{
-		std::scoped_lock<std::mutex> Lock(AccessMutex);
+		Job_T Job;
 
-		Jobs.push_back(std::move(Job));
+		while (this->TransferFront(Job))
+		{
+			Job.reset();
+		}
 	}
 
-	bool FJobQueue::TransferFront(JobPointer_T& Job)
+	bool FJobQueue::TrySubmit(Job_T& Job)
 	{
-		std::scoped_lock<std::mutex> Lock(AccessMutex);
+		size_t Position = EnqueuePosition.load(std::memory_order_relaxed);
 
-		if (Jobs.empty())
+		for (;;)
 		{
-			return false;
+			FCell& Cell = Cells[Position & Mask];
+
+			const size_t    Sequence   = Cell.Sequence.load(std::memory_order_acquire);
+			const ptrdiff_t Difference = static_cast<ptrdiff_t>(Sequence) - static_cast<ptrdiff_t>(Position);
+
+			if (Difference == 0)
+			{
+				if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					Cell.Job = Job.release();
+
+					// Hands the slot to the consumer at this position.
+					Cell.Sequence.store(Position + 1, std::memory_order_release);
+
+					return true;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// The consumer of the previous lap hasn't freed this slot yet.
+				return false;
+			}
+			else
+			{
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
 		}
+	}
+
+	size_t FJobQueue::TrySubmitBatch(IJob* const* Batch, size_t Count)
+	{
+		for (size_t i = 0; i < Count; ++i)
+		{
+			Job_T Job(Batch[i]);
 
-		Job = std::move(Jobs.front());
+			if (!this->TrySubmit(Job))
+			{
+				// Still owned by the caller's batch.
+				Job.release();
 
-		Jobs.pop_front();
+				return i;
+			}
+		}
 
-		return true;
+		return Count;
 	}
 
-	bool FJobQueue::IsEmpty() const
+	void FJobQueue::Submit(Job_T&& Job)
+	{
+		this->Submit(std::move(Job), []() { return false; });
+	}
+
+	void FJobQueue::SubmitBatch(IJob* const* Batch, size_t Count)
 	{
-		std::scoped_lock<std::mutex> Lock(AccessMutex);
+		for (size_t Submitted = this->TrySubmitBatch(Batch, Count); Submitted < Count; ++Submitted)
+		{
+			this->Submit(Job_T(Batch[Submitted]));
+		}
+	}
 
-		return Jobs.empty();
+	bool FJobQueue::TransferFront(Job_T& Job)
+	{
+		size_t Position = DequeuePosition.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			FCell& Cell = Cells[Position & Mask];
+
+			const size_t    Sequence   = Cell.Sequence.load(std::memory_order_acquire);
+			const ptrdiff_t Difference = static_cast<ptrdiff_t>(Sequence) - static_cast<ptrdiff_t>(Position + 1);
+
+			if (Difference == 0)
+			{
+				if (DequeuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					Job.reset(Cell.Job);
+
+					// Frees the slot for the producer one lap ahead.
+					Cell.Sequence.store(Position + Mask + 1, std::memory_order_release);
+
+					return true;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// Empty, or the producer at this position hasn't published yet.
+				return false;
+			}
+			else
+			{
+				Position = DequeuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool FJobQueue::IsEmpty() const
+	{
+		return this->Size() == 0;
 	}
 
 	size_t FJobQueue::Size() const
 	{
-		std::scoped_lock<std::mutex> Lock(AccessMutex);
+		const size_t Dequeued = DequeuePosition.load(std::memory_order_relaxed);
+		const size_t Enqueued = EnqueuePosition.load(std::memory_order_relaxed);
+
+		return Enqueued > Dequeued ? Enqueued - Dequeued : 0;
+	}
+
+	size_t FJobQueue::GetCapacity() const
+	{
+		return Mask + 1;
+	}
 
-		return Jobs.size();
+	int64_t FJobQueue::GetFullWaitNanoseconds() const
+	{
+		return FullWaitNanoseconds.load(std::memory_order_relaxed);
 	}
 
 }
\ No newline at end of file
@@ -1,35 +1,109 @@
 #pragma once
 
-#include <deque>
-#include <functional>
+#include "IJob.h"
+#include "FAtomicLock.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
-#include <mutex>
+#include <thread>
 
 namespace t3d
 {
-	using Functor_T    = std::function<void()>;
-	using JobPointer_T = std::unique_ptr<Functor_T>;
+	enum class EJobPriority : uint8_t
+	{
+		  High = 0
+		, Normal
+		, Background
+		, Count
+	};
+
+	// What a producer does when the queue it submits to is full.
+	enum class EJobQueueFull : uint8_t
+	{
+		// Back off until a consumer makes room, a worker of the job system runs other jobs meanwhile.
+		  Wait = 0
+
+		// Run the job right away on the producing thread.
+		, RunInline
+	};
 
+	// Bounded multi-producer/multi-consumer ring (Vyukov). Every slot carries a sequence number that tells
+	// producers and consumers whose turn it is, so each side only races on its own position and nothing is locked.
 	class FJobQueue
 	{
 	public:
 
-		 FJobQueue () = default;
-		~FJobQueue () = default;
+		static constexpr size_t DefaultCapacity = 4096;
+
+		// Rounded up to a power of two.
+		explicit FJobQueue (size_t InCapacity = DefaultCapacity);
+		        ~FJobQueue ();
 
 		// No copy
 		// No move
 
-		void Submit        (JobPointer_T&& Job);
-		bool TransferFront (JobPointer_T& Job);
+		// Fails if the queue is full, the job then stays with the caller.
+		bool   TrySubmit      (Job_T& Job);
 
-		bool   IsEmpty () const;
-		size_t Size    () const;
+		// Returns how many jobs from the front of Batch went in.
+		size_t TrySubmitBatch (IJob* const* Batch, size_t Count);
+
+		// Waits while the queue is full. Help() runs between attempts and returns true if it did something useful.
+		template<typename Help_T>
+		void Submit(Job_T&& Job, Help_T&& Help)
+		{
+			if (this->TrySubmit(Job))
+			{
+				return;
+			}
+
+			const auto Start = std::chrono::steady_clock::now();
+
+			for (uint32_t Attempt = 0; !this->TrySubmit(Job); ++Attempt)
+			{
+				if (Help())
+				{
+					continue;
+				}
+
+				if (Attempt < FAtomicLock::DefaultSpinCount)
+				{
+					CpuRelax();
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			FullWaitNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count(), std::memory_order_relaxed);
+		}
+
+		void Submit        (Job_T&& Job);
+		void SubmitBatch   (IJob* const* Batch, size_t Count);
+		bool TransferFront (Job_T& Job);
+
+		// Lock-free snapshots, a push or pop that is half done may or may not be counted.
+		bool    IsEmpty                () const;
+		size_t  Size                   () const;
+		size_t  GetCapacity            () const;
+		int64_t GetFullWaitNanoseconds () const;
 
 	private:
 
-		mutable std::mutex        AccessMutex;
-		std::deque<JobPointer_T>  Jobs;
+		struct FCell
+		{
+			std::atomic<size_t> Sequence;
+			IJob*               Job;
+		};
+
+		const size_t                     Mask;
+		std::unique_ptr<FCell[]>         Cells;
+		alignas(64) std::atomic<size_t>  EnqueuePosition;
+		alignas(64) std::atomic<size_t>  DequeuePosition;
+		alignas(64) std::atomic<int64_t> FullWaitNanoseconds;
 	};
 
 //	constexpr size_t Size = sizeof(FJobQueue);
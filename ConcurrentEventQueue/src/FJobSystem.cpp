@@ -1,18 +1,93 @@
 #include "FJobSystem.h"
 
+#include <algorithm>
+#include <cassert>
+
 namespace t3d
 {
 // Constructors and Destructor:
 
-	FJobSystem::FJobSystem()
-		: b_Running (false)
+	FJobSystem::FJobSystem(const FJobSystemConfig& InConfig)
+		: Config             (InConfig)
+		, TimerThread        (this, InConfig.TimerResolution)
+		, b_Running          (false)
+		, NextWorker         (0)
+		, NextRealtimeWorker (0)
+		, FrameIndex         (0)
+		, RunningWorkerCount (0)
+		, PeakWorkerCount    (0)
+		, SpawnCount         (0)
+		, RetireCount        (0)
+		, Utilization        (0.0)
+		, OverloadedSince    (0)
 	{
-		WorkerThreads.reserve(4);
+		const size_t CoreCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MaxCoreCount);
+
+		// Otherwise a mask of only missing cores reads as empty and the realtime workers go wherever the defaults put them.
+		assert((Config.RealtimeCores >> CoreCount).none() && "Realtime core beyond the cores of this machine!");
+
+		std::vector<uint32_t> FreeCores;
+
+		for (uint32_t Core = 0; Core < CoreCount; ++Core)
+		{
+			if (!Config.ReservedCores.test(Core) && !Config.RealtimeCores.test(Core))
+			{
+				FreeCores.push_back(Core);
+			}
+		}
+
+		std::vector<uint32_t> RealtimeCores;
+
+		for (uint32_t Core = 0; Core < CoreCount; ++Core)
+		{
+			if (Config.RealtimeCores.test(Core))
+			{
+				RealtimeCores.push_back(Core);
+			}
+		}
+
+		// A busy-polling worker sharing its core would only steal time from whoever else runs there.
+		if (Config.RealtimeWorkerCount > 0 && RealtimeCores.empty() && FreeCores.size() > Config.RealtimeWorkerCount)
+		{
+			RealtimeCores.assign(FreeCores.end() - Config.RealtimeWorkerCount, FreeCores.end());
+
+			FreeCores.resize(FreeCores.size() - Config.RealtimeWorkerCount);
+		}
 
-		WorkerThreads.push_back(std::make_unique<FWorkerThread>());
-		WorkerThreads.push_back(std::make_unique<FWorkerThread>());
-		WorkerThreads.push_back(std::make_unique<FWorkerThread>());
-		WorkerThreads.push_back(std::make_unique<FWorkerThread>());
+		if (Config.WorkerCount == 0)
+		{
+			Config.WorkerCount = static_cast<uint32_t>(std::max<size_t>(FreeCores.size(), 1));
+		}
+
+		if (Config.MinWorkerCount == 0 || Config.MinWorkerCount > Config.WorkerCount)
+		{
+			Config.MinWorkerCount = Config.WorkerCount;
+		}
+
+		assert((!Config.b_PinWorkers || !FreeCores.empty()) && "Every core is reserved, nothing to pin workers to!");
+
+		if (Config.TraceCapacity > 0)
+		{
+			Tracer = std::make_unique<FJobTracer>(Config.WorkerCount, Config.TraceCapacity);
+		}
+
+		WorkerThreads.reserve(Config.WorkerCount);
+
+		for (uint32_t Index = 0; Index < Config.WorkerCount; ++Index)
+		{
+			const int32_t Core = Config.b_PinWorkers && !FreeCores.empty() ? static_cast<int32_t>(FreeCores[Index % FreeCores.size()]) : -1;
+
+			WorkerThreads.push_back(std::make_unique<FWorkerThread>(this, Index, Core));
+		}
+
+		RealtimeWorkers.reserve(Config.RealtimeWorkerCount);
+
+		for (uint32_t Index = 0; Index < Config.RealtimeWorkerCount; ++Index)
+		{
+			const int32_t Core = !RealtimeCores.empty() ? static_cast<int32_t>(RealtimeCores[Index % RealtimeCores.size()]) : -1;
+
+			RealtimeWorkers.push_back(std::make_unique<FRealtimeWorker>(this, Config.WorkerCount + Index, Core, Config.ScratchSize));
+		}
 	}
 
 	FJobSystem::~FJobSystem()
@@ -30,22 +105,159 @@ namespace t3d
 	{
 		b_Running.store(true);
 
-		for (auto& Thread : WorkerThreads)
+		for (uint32_t Index = 0; Index < Config.MinWorkerCount; ++Index)
+		{
+			WorkerThreads[Index]->Launch();
+		}
+
+		for (auto& Worker : RealtimeWorkers)
 		{
-			Thread->Launch();
+			Worker->Launch();
 		}
+
+		RunningWorkerCount.store(Config.MinWorkerCount);
+		PeakWorkerCount.store(Config.MinWorkerCount);
+
+		// A fixed pool has nothing to look after, the elastic one samples its queues a few times per SpawnDelay.
+		const std::chrono::nanoseconds Maintenance = Config.MinWorkerCount < Config.WorkerCount
+			? std::max<std::chrono::nanoseconds>(Config.TimerResolution, Config.SpawnDelay / 4)
+			: std::chrono::nanoseconds::zero();
+
+		TimerThread.Launch(Maintenance);
 	}
 
 	void FJobSystem::Shutdown()
 	{
 		b_Running.store(false);
-	
+
+		// Timers pending now are dropped, whatever they already handed out still runs.
+		TimerThread.Stop();
+
+		std::scoped_lock<std::mutex> Lock(PoolMutex);
+
 		for (auto& Thread : WorkerThreads)
 		{
-			Thread->Stop();
+			if (Thread->b_Launched)
+			{
+				Thread->Stop();
+			}
+		}
+
+		RunningWorkerCount.store(0);
+
+		// Last, deadline-bound jobs tend to be at the end of a chain, not the start of one.
+		for (auto& Worker : RealtimeWorkers)
+		{
+			Worker->Stop();
 		}
 	}
 
+	void FJobSystem::Submit(Job_T&& Job, EJobPriority Priority)
+	{
+		FWorkerThread* Current = FWorkerThread::GetCurrent();
+
+		// Spawned from inside a job: keep it on the local deque, an idle peer will steal it if needed.
+		if (Current && Current->JobSystem == this)
+		{
+			Current->Submit(std::move(Job), Priority);
+
+			this->WakeIdleWorker(Current);
+
+			return;
+		}
+
+		FWorkerThread* Target = this->PinAnyWorker(NextWorker.fetch_add(1, std::memory_order_relaxed), true);
+
+		Target->Submit(std::move(Job), Priority);
+
+		Target->Unpin();
+	}
+
+	void FJobSystem::SubmitBatch(IJob* const* Jobs, size_t Count, EJobPriority Priority)
+	{
+		if (Count == 0)
+		{
+			return;
+		}
+
+		FWorkerThread* Current = FWorkerThread::GetCurrent();
+
+		// From inside a job the whole batch stays local, idle peers are woken to steal their share.
+		if (Current && Current->JobSystem == this)
+		{
+			Current->SubmitBatch(Jobs, Count, Priority);
+
+			this->WakeIdleWorker(Current, Count - 1);
+
+			return;
+		}
+
+		// Contiguous runs, one per running worker, so each worker takes a single chain and a single wake-up.
+		const size_t WorkerCount = std::max<size_t>(RunningWorkerCount.load(std::memory_order_relaxed), 1);
+		const size_t RunCount    = std::min(Count, WorkerCount);
+		const size_t Start       = NextWorker.fetch_add(RunCount, std::memory_order_relaxed);
+
+		size_t First = 0;
+
+		for (size_t Run = 0; Run < RunCount; ++Run)
+		{
+			const size_t RunSize = Count / RunCount + (Run < Count % RunCount ? 1 : 0);
+
+			FWorkerThread* Target = this->PinAnyWorker(Start + Run, false);
+
+			Target->SubmitBatch(Jobs + First, RunSize, Priority);
+
+			Target->Unpin();
+
+			First += RunSize;
+		}
+	}
+
+	bool FJobSystem::CancelTimer(FTimerId Id)
+	{
+		return TimerThread.Cancel(Id);
+	}
+
+	void FJobSystem::EndFrame()
+	{
+		FrameIndex.fetch_add(1, std::memory_order_release);
+	}
+
+	void FJobSystem::SubmitRealtime(Job_T&& Job)
+	{
+		assert(!RealtimeWorkers.empty() && "No realtime workers, see FJobSystemConfig::RealtimeWorkerCount!");
+
+		const size_t Index = RealtimeWorkers.size() > 1 ? NextRealtimeWorker.fetch_add(1, std::memory_order_relaxed) % RealtimeWorkers.size() : 0;
+
+		RealtimeWorkers[Index]->Submit(std::move(Job));
+	}
+
+	bool FJobSystem::TryExecuteJob()
+	{
+		Job_T Job;
+
+		FWorkerThread* Current = FWorkerThread::GetCurrent();
+
+		const bool b_Found = Current && Current->JobSystem == this ? Current->FindJob(Job) : this->StealJob(nullptr, Job);
+
+		if (b_Found)
+		{
+			// Only worker threads have a trace ring.
+			if (Current && Current->JobSystem == this)
+			{
+				Current->RunJob(Job);
+			}
+			else
+			{
+				FScratchArena::FScope Scope(FScratchArena::GetCurrent());
+
+				Job->Execute();
+			}
+		}
+
+		return b_Found;
+	}
+
 
 // Accessors:
 
@@ -54,9 +266,283 @@ namespace t3d
 		return b_Running.load();
 	}
 
-	bool FJobSystem::IsBusy(EThreadId ThreadId) const
+	bool FJobSystem::IsBusy(size_t WorkerIndex) const
+	{
+		return WorkerThreads[WorkerIndex]->IsBusy();
+	}
+
+	size_t FJobSystem::GetWorkerCount() const
+	{
+		return WorkerThreads.size();
+	}
+
+	size_t FJobSystem::GetRealtimeWorkerCount() const
+	{
+		return RealtimeWorkers.size();
+	}
+
+	const FJobSystemConfig& FJobSystem::GetConfig() const
+	{
+		return Config;
+	}
+
+	const FJobTracer* FJobSystem::GetTracer() const
+	{
+		return Tracer.get();
+	}
+
+	FJobTraceStats FJobSystem::GetTraceStats() const
+	{
+		FJobTraceStats Stats = Tracer ? Tracer->GetStats() : FJobTraceStats();
+
+		for (const auto& Thread : WorkerThreads)
+		{
+			Stats.QueueFullWaitNanoseconds += Thread->HighJobs.GetFullWaitNanoseconds() + Thread->BackgroundJobs.GetFullWaitNanoseconds();
+		}
+
+		return Stats;
+	}
+
+	FWorkerPoolStats FJobSystem::GetPoolStats() const
+	{
+		FWorkerPoolStats Stats;
+
+		Stats.RunningWorkerCount = RunningWorkerCount.load(std::memory_order_relaxed);
+		Stats.PeakWorkerCount    = PeakWorkerCount.load(std::memory_order_relaxed);
+		Stats.SpawnCount         = SpawnCount.load(std::memory_order_relaxed);
+		Stats.RetireCount        = RetireCount.load(std::memory_order_relaxed);
+		Stats.Utilization        = Utilization.load(std::memory_order_relaxed);
+
+		for (const auto& Thread : WorkerThreads)
+		{
+			if (Thread->IsRunning())
+			{
+				Stats.QueuedJobCount += Thread->GetQueuedCount();
+			}
+		}
+
+		return Stats;
+	}
+
+
+// Private Functions:
+
+	FSlabPool& FJobSystem::GetJobPool()
+	{
+		FWorkerThread* Current = FWorkerThread::GetCurrent();
+
+		if (Current && Current->JobSystem == this)
+		{
+			return Current->JobPool;
+		}
+
+		// Outside threads spread their jobs over the workers' pools.
+		return WorkerThreads[NextWorker.load(std::memory_order_relaxed) % WorkerThreads.size()]->JobPool;
+	}
+
+	size_t FJobSystem::GetAutoGrain(size_t Count) const
+	{
+		// Around eight pieces per thread, the calling thread included, leaves stealing enough slack to balance.
+		return std::max<size_t>(1, Count / (8 * (WorkerThreads.size() + 1)));
+	}
+
+	bool FJobSystem::StealJob(FWorkerThread* Thief, Job_T& Job)
+	{
+		const size_t Count = WorkerThreads.size();
+
+		static thread_local uint32_t OutsideSeed = 2463534242u;
+
+		// Xorshift, so that thieves don't all hammer the same victim.
+		uint32_t& Seed = Thief ? Thief->VictimSeed : OutsideSeed;
+
+		Seed ^= Seed << 13;
+		Seed ^= Seed >> 17;
+		Seed ^= Seed << 5;
+
+		const size_t Start = Seed % Count;
+
+		// Every victim's high priority work before anybody's normal work, and so on.
+		for (size_t Level = 0; Level < static_cast<size_t>(EJobPriority::Count); ++Level)
+		{
+			const EJobPriority Priority = static_cast<EJobPriority>(Level);
+
+			for (size_t i = 0; i < Count; ++i)
+			{
+				FWorkerThread* Victim = WorkerThreads[(Start + i) % Count].get();
+
+				if (Victim == Thief)
+				{
+					continue;
+				}
+
+				if (Victim->Steal(Job, Priority))
+				{
+					// Victim still has work queued, pull in another idle worker.
+					if (Victim->HasLocal(Priority))
+					{
+						this->WakeIdleWorker(Thief);
+					}
+
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void FJobSystem::WakeIdleWorker(FWorkerThread* Waker, size_t MaxCount)
+	{
+		for (auto& Thread : WorkerThreads)
+		{
+			if (MaxCount == 0)
+			{
+				return;
+			}
+
+			if (Thread.get() != Waker && Thread->IsRunning() && !Thread->IsBusy())
+			{
+				Thread->Wake();
+
+				--MaxCount;
+			}
+		}
+	}
+
+	FWorkerThread* FJobSystem::PinAnyWorker(size_t Start, bool b_PreferIdle)
 	{
-		return WorkerThreads[static_cast<size_t>(ThreadId)]->IsBusy();
+		const size_t Count = WorkerThreads.size();
+
+		for (size_t Pass = b_PreferIdle ? 0 : 1; Pass < 2; ++Pass)
+		{
+			for (size_t i = 0; i < Count; ++i)
+			{
+				FWorkerThread* Candidate = WorkerThreads[(Start + i) % Count].get();
+
+				if (Candidate->IsRunning() && (Pass == 1 || !Candidate->IsBusy()) && Candidate->TryPin())
+				{
+					return Candidate;
+				}
+			}
+		}
+
+		// Shutting down. The first worker never retires, it drains whatever still comes in.
+		FWorkerThread* First = WorkerThreads[0].get();
+
+		First->TryPin();
+
+		return First;
+	}
+
+	FWorkerThread* FJobSystem::PinWorker(size_t WorkerIndex)
+	{
+		FWorkerThread* Worker = WorkerThreads[WorkerIndex].get();
+
+		for (;;)
+		{
+			if (Worker->TryPin())
+			{
+				// Before Startup or after Shutdown the job just waits in the queue, same as for a fixed pool.
+				if (Worker->IsRunning() || !b_Running.load())
+				{
+					return Worker;
+				}
+
+				Worker->Unpin();
+			}
+
+			// Halfway through retiring, it either finishes or takes the job after all.
+			if (!this->StartWorker(Worker))
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	bool FJobSystem::StartWorker(FWorkerThread* Worker)
+	{
+		std::scoped_lock<std::mutex> Lock(PoolMutex);
+
+		if (!b_Running.load() || Worker->IsRunning())
+		{
+			return false;
+		}
+
+		Worker->Launch();
+
+		const uint32_t Running = RunningWorkerCount.fetch_add(1, std::memory_order_relaxed) + 1;
+
+		SpawnCount.fetch_add(1, std::memory_order_relaxed);
+
+		uint32_t Peak = PeakWorkerCount.load(std::memory_order_relaxed);
+
+		while (Running > Peak && !PeakWorkerCount.compare_exchange_weak(Peak, Running, std::memory_order_relaxed))
+		{
+		}
+
+		return true;
+	}
+
+	void FJobSystem::ScaleWorkers()
+	{
+		const int64_t Now = FJobTracer::Now();
+
+		size_t         Queued  = 0;
+		uint32_t       Running = 0;
+		uint32_t       Busy    = 0;
+		FWorkerThread* Spare   = nullptr;
+		FWorkerThread* Idle    = nullptr;
+
+		for (auto& Thread : WorkerThreads)
+		{
+			if (!Thread->IsRunning())
+			{
+				Spare = Spare ? Spare : Thread.get();
+
+				continue;
+			}
+
+			const bool b_Busy = Thread->IsBusy();
+
+			Queued  += Thread->GetQueuedCount();
+			Running += 1;
+			Busy    += b_Busy ? 1 : 0;
+
+			// The highest one goes first, so the running workers stay packed at the front.
+			if (Thread->b_CanRetire && !b_Busy && Now - Thread->IdleSince.load(std::memory_order_relaxed) >= std::chrono::nanoseconds(Config.RetireTimeout).count())
+			{
+				Idle = Thread.get();
+			}
+		}
+
+		// Roughly the last eight samples.
+		const double Sample = Running > 0 ? static_cast<double>(Busy) / Running : 0.0;
+
+		Utilization.store(Utilization.load(std::memory_order_relaxed) * 0.875 + Sample * 0.125, std::memory_order_relaxed);
+
+		if (Queued > static_cast<size_t>(Config.SpawnQueueDepth) * Running)
+		{
+			OverloadedSince = OverloadedSince != 0 ? OverloadedSince : Now;
+
+			// One worker per SpawnDelay, so a short burst doesn't start the whole pool.
+			if (Spare && Now - OverloadedSince >= std::chrono::nanoseconds(Config.SpawnDelay).count())
+			{
+				this->StartWorker(Spare);
+
+				OverloadedSince = Now;
+			}
+
+			return;
+		}
+
+		OverloadedSince = 0;
+
+		if (Idle)
+		{
+			Idle->b_RetireRequested.store(true);
+
+			Idle->Wake();
+		}
 	}
 
 }
\ No newline at end of file
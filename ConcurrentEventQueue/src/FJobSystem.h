@@ -1,19 +1,37 @@
 #pragma once
 
 #include "FWorkerThread.h"
+#include "FRealtimeWorker.h"
+#include "FJobSystemConfig.h"
+#include "FJobGate.h"
+#include "FJobBatch.h"
+#include "FJobCounter.h"
+#include "FTimerThread.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
 #include <type_traits>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <span>
 
 namespace t3d
 {
-	enum class EThreadId
+	struct FWorkerPoolStats
 	{
-		  Zero = 0
-		, One
-		, Two
-		, Three
+		uint32_t RunningWorkerCount = 0;
+		uint32_t PeakWorkerCount    = 0;
+		uint64_t SpawnCount         = 0;
+		uint64_t RetireCount        = 0;
+
+		// Jobs waiting in the running workers' queues right now.
+		size_t   QueuedJobCount     = 0;
+
+		// Share of running workers that were busy, averaged over the last few samples of the elastic pool. Zero for a fixed pool.
+		double   Utilization        = 0.0;
 	};
 
 	class FJobSystem
@@ -22,7 +40,7 @@ namespace t3d
 
 	// Constructors and Destructor:
 
-		 FJobSystem ();
+		 FJobSystem (const FJobSystemConfig& InConfig = FJobSystemConfig());
 		~FJobSystem ();
 
 		// No copy
@@ -36,23 +54,331 @@ namespace t3d
 		template<typename Functor_T, typename... Args_T>
 		using Return_T = std::invoke_result_t<Functor_T, Args_T...>;
 
+		// Pinned to the given worker, a retired one is started again for it.
+		template<typename Functor_T>
+		JobHandle_T<Return_T<Functor_T>> Schedule(size_t WorkerIndex, Functor_T&& Job, const char* Name = nullptr)
+		{
+			FWorkerThread* Worker = this->PinWorker(WorkerIndex);
+
+			JobHandle_T<Return_T<Functor_T>> Handle = Worker->Schedule(std::forward<Functor_T>(Job), Name);
+
+			Worker->Unpin();
+
+			return Handle;
+		}
+
+		// Executed by whichever worker gets to it first.
+		template<typename Functor_T>
+		JobHandle_T<Return_T<Functor_T>> Schedule(Functor_T&& Job)
+		{
+			return this->Schedule(EJobPriority::Normal, std::forward<Functor_T>(Job));
+		}
+
+		// Workers drain High before Normal before Background, lower levels age up so they can't starve.
+		// Name shows up in traces, it has to outlive the tracer.
+		template<typename Functor_T>
+		JobHandle_T<Return_T<Functor_T>> Schedule(EJobPriority Priority, Functor_T&& Job, const char* Name = nullptr)
+		{
+			auto* InternalJob = TJob<Return_T<Functor_T>, std::decay_t<Functor_T>>::Create(this->GetJobPool(), std::forward<Functor_T>(Job));
+
+			JobHandle_T<Return_T<Functor_T>> Handle = InternalJob->GetHandle();
+
+			InternalJob->Name = Name;
+
+			this->Submit(Job_T(InternalJob), Priority);
+
+			return Handle;
+		}
+
+		// Runs on a busy-polling realtime worker, see FJobSystemConfig::RealtimeWorkerCount. On a pinned worker it starts
+		// within microseconds of the call, an unpinned one gives no such bound. Either way it shares that worker with every
+		// other realtime job, so keep it short and don't wait in it.
+		template<typename Functor_T>
+		JobHandle_T<Return_T<Functor_T>> ScheduleRealtime(Functor_T&& Job, const char* Name = nullptr)
+		{
+			auto* InternalJob = TJob<Return_T<Functor_T>, std::decay_t<Functor_T>>::Create(this->GetJobPool(), std::forward<Functor_T>(Job));
+
+			JobHandle_T<Return_T<Functor_T>> Handle = InternalJob->GetHandle();
+
+			InternalJob->Name = Name;
+
+			this->SubmitRealtime(Job_T(InternalJob));
+
+			return Handle;
+		}
+
+		// Runnable once every prerequisite handle has signaled, no worker blocks in the meantime.
+		template<typename Functor_T, typename... Prerequisites_T>
+			requires (sizeof...(Prerequisites_T) > 0 && (IsJobHandle_V<Prerequisites_T> && ...))
+		JobHandle_T<Return_T<Functor_T>> Schedule(Functor_T&& Job, const Prerequisites_T&... Prerequisites)
+		{
+			FSlabPool& Pool = this->GetJobPool();
+
+			auto* InternalJob = TJob<Return_T<Functor_T>, std::decay_t<Functor_T>>::Create(Pool, std::forward<Functor_T>(Job));
+
+			JobHandle_T<Return_T<Functor_T>> Handle = InternalJob->GetHandle();
+
+			auto* Gate = TJobGate<sizeof...(Prerequisites_T)>::Create(Pool, this, InternalJob);
+
+			Gate->Wait({ static_cast<FJobHandleBase*>(Prerequisites.get())... });
+
+			return Handle;
+		}
+
+		// Counted against Counter instead of getting a handle: Counter goes up now and down once the job is done.
+		// Wait on Counter or schedule dependents with Counter.When() as prerequisite.
 		template<typename Functor_T>
-		JobHandle_T<Return_T<Functor_T>> Schedule(EThreadId ThreadId, Functor_T&& Job)
+		void Schedule(FJobCounter& Counter, Functor_T&& Job, EJobPriority Priority = EJobPriority::Normal, const char* Name = nullptr)
 		{
-			return WorkerThreads[static_cast<size_t>(ThreadId)]->Schedule(std::move(Job));
+			auto* InternalJob = TCountedJob<std::decay_t<Functor_T>>::Create(this->GetJobPool(), Counter, std::forward<Functor_T>(Job));
+
+			InternalJob->Name = Name;
+
+			Counter.Increment();
+
+			this->Submit(Job_T(InternalJob), Priority);
 		}
 
+		// Submits Job once Delay has passed, rounded up to the timer resolution. Cancel the timer to drop it before then.
+		template<typename Rep_T, typename Period_T, typename Functor_T>
+		FTimerId ScheduleAfter(std::chrono::duration<Rep_T, Period_T> Delay, Functor_T&& Job, EJobPriority Priority = EJobPriority::Normal)
+		{
+			return TimerThread.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(Delay), std::chrono::nanoseconds::zero(), Priority, std::forward<Functor_T>(Job));
+		}
+
+		// Submits a copy of Job every Period until the timer is cancelled. Periods missed under load are skipped, not made up.
+		template<typename Rep_T, typename Period_T, typename Functor_T>
+		FTimerId ScheduleEvery(std::chrono::duration<Rep_T, Period_T> Period, Functor_T&& Job, EJobPriority Priority = EJobPriority::Normal)
+		{
+			static_assert(std::is_copy_constructible_v<std::decay_t<Functor_T>>, "Periodic jobs are copied for every period!");
+
+			const auto Nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(Period);
+
+			return TimerThread.Add(Nanoseconds, Nanoseconds, Priority, std::forward<Functor_T>(Job));
+		}
+
+		bool CancelTimer(FTimerId Id);
+
+		// Frame boundary for FJobSystemConfig::b_ScratchPerFrame. Scratch taken before the call is reclaimed
+		// by each worker once it has no job in flight anymore.
+		void EndFrame();
+
+		// Publishes every job at once with a single wake-up per worker, see FJobBatch to keep the per-job handles.
+		template<typename Functor_T>
+		JobHandle_T<void> ScheduleBatch(std::span<Functor_T> Jobs, EJobPriority Priority = EJobPriority::Normal)
+		{
+			FJobBatch Batch(*this, Priority);
+
+			Batch.Reserve(Jobs.size());
+
+			for (Functor_T& Job : Jobs)
+			{
+				Batch.Add(Job);
+			}
+
+			return Batch.Submit();
+		}
+
+		// Fan-out without a handle per job, the jobs count Counter down as they finish.
+		template<typename Functor_T>
+		void ScheduleBatch(FJobCounter& Counter, std::span<Functor_T> Jobs, EJobPriority Priority = EJobPriority::Normal)
+		{
+			FSlabPool& Pool = this->GetJobPool();
+
+			std::vector<IJob*> InternalJobs;
+
+			InternalJobs.reserve(Jobs.size());
+
+			for (Functor_T& Job : Jobs)
+			{
+				InternalJobs.push_back(TCountedJob<std::decay_t<Functor_T>>::Create(Pool, Counter, Job));
+			}
+
+			Counter.Increment(static_cast<uint32_t>(Jobs.size()));
+
+			this->SubmitBatch(InternalJobs.data(), InternalJobs.size(), Priority);
+		}
+
+		// Splits [Begin, End) in halves down to Grain and runs them on the workers, the calling thread joins in.
+		// Body takes either one index or a (Begin, End) sub-range. Grain 0 picks one from the range size and worker count.
+		template<typename Index_T, typename Body_T>
+		void ParallelFor(Index_T Begin, Index_T End, Index_T Grain, Body_T&& Body)
+		{
+			if (End <= Begin)
+			{
+				return;
+			}
+
+			if (Grain <= 0)
+			{
+				Grain = static_cast<Index_T>(this->GetAutoGrain(static_cast<size_t>(End - Begin)));
+			}
+
+			std::atomic<size_t> Pending = 1;
+
+			this->ParallelForRange(Begin, End, Grain, Body, Pending);
+
+			this->HelpUntil([&Pending]() { return Pending.load(std::memory_order_acquire) == 0; });
+		}
+
+		// Folds a random-access range with an associative Reduce(Value, Value), chunk partials are combined in order.
+		template<typename Range_T, typename Value_T, typename Reduce_T>
+		Value_T ParallelReduce(const Range_T& Range, Value_T Identity, Reduce_T&& Reduce, size_t Grain = 0)
+		{
+			struct alignas(64) FPartial
+			{
+				Value_T Value;
+			};
+
+			const auto   First = std::begin(Range);
+			const size_t Count = static_cast<size_t>(std::size(Range));
+
+			if (Count == 0)
+			{
+				return Identity;
+			}
+
+			if (Grain == 0)
+			{
+				Grain = this->GetAutoGrain(Count);
+			}
+
+			const size_t ChunkCount = (Count + Grain - 1) / Grain;
+
+			std::vector<FPartial> Partials(ChunkCount, FPartial{ Identity });
+
+			this->ParallelFor<size_t>(0, ChunkCount, 1, [&](size_t Chunk)
+				{
+					Value_T Accumulator = Identity;
+
+					const size_t ChunkBegin = Chunk * Grain;
+					const size_t ChunkEnd   = std::min(Count, ChunkBegin + Grain);
+
+					for (auto It = First + ChunkBegin, Last = First + ChunkEnd; It != Last; ++It)
+					{
+						Accumulator = Reduce(Accumulator, *It);
+					}
+
+					Partials[Chunk].Value = Accumulator;
+				});
+
+			Value_T Result = Identity;
+
+			for (const FPartial& Partial : Partials)
+			{
+				Result = Reduce(Result, Partial.Value);
+			}
+
+			return Result;
+		}
+
+		void Submit         (Job_T&& Job, EJobPriority Priority = EJobPriority::Normal);
+		void SubmitBatch    (IJob* const* Jobs, size_t Count, EJobPriority Priority = EJobPriority::Normal);
+		void SubmitRealtime (Job_T&& Job);
+		bool TryExecuteJob  ();
+
 	// Accessors:
 
-		bool IsRunning () const;
-		bool IsBusy    (EThreadId ThreadId) const;
+		bool                    IsRunning      () const;
+		bool                    IsBusy         (size_t WorkerIndex) const;
+		size_t                  GetWorkerCount         () const;
+		size_t                  GetRealtimeWorkerCount () const;
+		const FJobSystemConfig& GetConfig              () const;
+
+		// Null unless FJobSystemConfig::TraceCapacity is set.
+		const FJobTracer*       GetTracer              () const;
+		FJobTraceStats          GetTraceStats          () const;
+		FWorkerPoolStats        GetPoolStats           () const;
 
 	private:
 
+	// Private Functions:
+
+		template<typename Index_T, typename Body_T>
+		void ParallelForRange(Index_T Begin, Index_T End, Index_T Grain, Body_T& Body, std::atomic<size_t>& Pending)
+		{
+			// Keep the left half, hand out the right one. Thieves take from the top, so they get the biggest pieces.
+			while (End - Begin > Grain)
+			{
+				const Index_T Middle = Begin + (End - Begin) / 2;
+
+				Pending.fetch_add(1, std::memory_order_relaxed);
+
+				auto RightHalf = [this, Middle, End, Grain, &Body, &Pending]()
+					{
+						this->ParallelForRange(Middle, End, Grain, Body, Pending);
+					};
+
+				this->Submit(Job_T(TDetachedJob<decltype(RightHalf)>::Create(this->GetJobPool(), std::move(RightHalf))));
+
+				End = Middle;
+			}
+
+			if constexpr (std::is_invocable_v<Body_T&, Index_T, Index_T>)
+			{
+				Body(Begin, End);
+			}
+			else
+			{
+				for (Index_T Index = Begin; Index < End; ++Index)
+				{
+					Body(Index);
+				}
+			}
+
+			Pending.fetch_sub(1, std::memory_order_release);
+		}
+
+		// Runs other jobs on the calling thread until Predicate holds.
+		template<typename Predicate_T>
+		void HelpUntil(Predicate_T&& Predicate)
+		{
+			while (!Predicate())
+			{
+				if (!this->TryExecuteJob())
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		FSlabPool&     GetJobPool     ();
+		size_t         GetAutoGrain   (size_t Count) const;
+		bool           StealJob       (FWorkerThread* Thief, Job_T& Job);
+		void           WakeIdleWorker (FWorkerThread* Waker, size_t MaxCount = 1);
+
+		// Elastic pool. Producers outside the pool push to a pinned worker, so it can't retire under them. Unpin when done.
+		FWorkerThread* PinAnyWorker   (size_t Start, bool b_PreferIdle);
+		FWorkerThread* PinWorker      (size_t WorkerIndex);
+		bool           StartWorker    (FWorkerThread* Worker);
+
+		// Called by the timer thread: starts a worker while jobs pile up and retires the ones that idle too long.
+		void           ScaleWorkers   ();
+
 	// Variables:
 
-		std::vector<std::unique_ptr<FWorkerThread>> WorkerThreads;
-		std::atomic<bool>                           b_Running;
+		FJobSystemConfig                              Config;
+		std::unique_ptr<FJobTracer>                   Tracer;
+		FTimerThread                                  TimerThread;
+		std::vector<std::unique_ptr<FWorkerThread>>   WorkerThreads;
+		std::vector<std::unique_ptr<FRealtimeWorker>> RealtimeWorkers;
+		std::atomic<bool>                             b_Running;
+		std::atomic<size_t>                           NextWorker;
+		std::atomic<size_t>                           NextRealtimeWorker;
+		std::atomic<uint64_t>                         FrameIndex;
+		std::mutex                                    PoolMutex;
+		std::atomic<uint32_t>                         RunningWorkerCount;
+		std::atomic<uint32_t>                         PeakWorkerCount;
+		std::atomic<uint64_t>                         SpawnCount;
+		std::atomic<uint64_t>                         RetireCount;
+		std::atomic<double>                           Utilization;
+		int64_t                                       OverloadedSince;
+
+		friend class FWorkerThread;
+		friend class FJobBatch;
+		friend class FPipeline;
+		friend class FStrand;
+		friend class FTimerThread;
 	};
 
 //	constexpr size_t Size = sizeof(FJobSystem);
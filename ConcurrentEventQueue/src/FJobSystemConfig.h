@@ -0,0 +1,80 @@
+#pragma once
+
+#include "FAtomicLock.h"
+#include "FJobQueue.h"
+
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+
+namespace t3d
+{
+	constexpr size_t MaxCoreCount = 1024;
+
+	using CoreMask_T = std::bitset<MaxCoreCount>;
+
+	struct FJobSystemConfig
+	{
+		// Zero means one worker per core that is not reserved, std::thread::hardware_concurrency() by default.
+		uint32_t   WorkerCount   = 0;
+
+		// Elastic pool: only MinWorkerCount workers start with the system, the rest up to WorkerCount come and go with the load.
+		// Zero keeps all WorkerCount workers running for good.
+		uint32_t   MinWorkerCount = 0;
+
+		// Pin each worker to its own unreserved core.
+		bool       b_PinWorkers  = false;
+
+		// Cores the job system keeps its hands off, e.g. for the main or audio thread.
+		CoreMask_T ReservedCores;
+
+		// Busy-polling workers for FJobSystem::ScheduleRealtime, each spins on its queue and burns a core for good.
+		// They are pinned to RealtimeCores. Left empty, they take the highest unreserved cores as long as one is left for
+		// the other workers. Only b_PinWorkers keeps the other workers off those cores, unpinned ones may still be scheduled there.
+		// With no core to pin to, realtime workers run unpinned: they compete for time slices like any thread, so a job
+		// can wait a whole slice before it starts and the spinning slows down whatever shares the core. RealtimeCores may only
+		// name cores the machine has.
+		uint32_t   RealtimeWorkerCount = 0;
+		CoreMask_T RealtimeCores;
+
+		// A lower priority level runs once it has been passed over this many times while it had work.
+		uint32_t   AgingThreshold = 16;
+
+		// How long an idle worker spins for new work before it parks, see FAtomicLock::Acquire.
+		uint32_t   IdleSpinCount  = FAtomicLock::DefaultSpinCount;
+
+		// A worker blocked in Await runs other queued jobs until the handle is ready.
+		// Only enable it if no job awaits something that a job further down the same stack has to release, e.g. a lock.
+		bool       b_HelpWhileWaiting = false;
+
+		// Events kept per worker for FJobTracer, zero disables tracing.
+		uint32_t   TraceCapacity  = 0;
+
+		// Fibers per worker, see FFiber. A job that awaits on a fiber parks and its worker moves on to other jobs.
+		// Zero runs jobs on the worker's own stack.
+		uint32_t   FiberCount     = 0;
+		uint32_t   FiberStackSize = 64 * 1024;
+
+		// Slots of each worker's High and Background queue, rounded up to a power of two, and what producers do once one is full.
+		uint32_t      JobQueueCapacity = FJobQueue::DefaultCapacity;
+		EJobQueueFull QueueFullPolicy  = EJobQueueFull::Wait;
+
+		// Bytes each worker's FScratchArena starts out with, it grows as needed and keeps its peak size.
+		uint32_t      ScratchSize       = 64 * 1024;
+
+		// Scratch memory stays valid until FJobSystem::EndFrame() instead of going away with the job that took it.
+		// Jobs a non-worker thread runs itself, e.g. while helping in ParallelFor, always give theirs back right away.
+		bool          b_ScratchPerFrame = false;
+
+		// Tick of the timer wheel behind ScheduleAfter and ScheduleEvery.
+		std::chrono::microseconds TimerResolution = std::chrono::milliseconds(1);
+
+		// Elastic pool only. Another worker starts once more than SpawnQueueDepth jobs per running worker have stayed queued
+		// for SpawnDelay. A worker above MinWorkerCount that found nothing to do for RetireTimeout ends its thread.
+		uint32_t                  SpawnQueueDepth = 16;
+		std::chrono::milliseconds SpawnDelay      = std::chrono::milliseconds(4);
+		std::chrono::milliseconds RetireTimeout   = std::chrono::seconds(2);
+	};
+
+//	constexpr size_t Size = sizeof(FJobSystemConfig);
+}
\ No newline at end of file
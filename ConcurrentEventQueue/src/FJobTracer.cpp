@@ -0,0 +1,271 @@
+#include "FJobTracer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace t3d
+{
+	static void WriteJsonString(std::ostream& Stream, const char* String)
+	{
+		Stream << '"';
+
+		for (const char* Character = String; *Character; ++Character)
+		{
+			const char Symbol = *Character;
+
+			if (Symbol == '"' || Symbol == '\\')
+			{
+				Stream << '\\' << Symbol;
+			}
+			else if (static_cast<unsigned char>(Symbol) < 0x20)
+			{
+				char Escaped[8];
+
+				std::snprintf(Escaped, sizeof(Escaped), "\\u%04x", static_cast<unsigned>(Symbol));
+
+				Stream << Escaped;
+			}
+			else
+			{
+				Stream << Symbol;
+			}
+		}
+
+		Stream << '"';
+	}
+
+
+// FJobTraceRing:
+
+	FJobTraceRing::FJobTraceRing(size_t Capacity)
+		: Slots      (new FSlot[std::bit_ceil(std::max<size_t>(Capacity, 2))])
+		, Mask       (std::bit_ceil(std::max<size_t>(Capacity, 2)) - 1)
+		, WriteIndex (0)
+	{}
+
+	void FJobTraceRing::Record(const FJobTraceEvent& Event)
+	{
+		const uint64_t Index = WriteIndex.load(std::memory_order_relaxed);
+
+		FSlot& Slot = Slots[Index & Mask];
+
+		Slot.Name.store(Event.Name, std::memory_order_relaxed);
+		Slot.EnqueueTime.store(Event.EnqueueTime, std::memory_order_relaxed);
+		Slot.StartTime.store(Event.StartTime, std::memory_order_relaxed);
+		Slot.EndTime.store(Event.EndTime, std::memory_order_relaxed);
+
+		WriteIndex.store(Index + 1, std::memory_order_release);
+	}
+
+	void FJobTraceRing::Snapshot(std::vector<FJobTraceEvent>& Events) const
+	{
+		const uint64_t Capacity = Mask + 1;
+		const uint64_t End      = WriteIndex.load(std::memory_order_acquire);
+
+		const size_t FirstEvent = Events.size();
+
+		for (uint64_t Index = End > Capacity ? End - Capacity : 0; Index < End; ++Index)
+		{
+			const FSlot& Slot = Slots[Index & Mask];
+
+			Events.push_back(FJobTraceEvent
+				{
+					Slot.Name.load(std::memory_order_relaxed),
+					Slot.EnqueueTime.load(std::memory_order_relaxed),
+					Slot.StartTime.load(std::memory_order_relaxed),
+					Slot.EndTime.load(std::memory_order_relaxed)
+				});
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		// The worker kept recording, the slot it is writing now and everything older than it may be torn.
+		const uint64_t Current = WriteIndex.load(std::memory_order_relaxed);
+		const uint64_t Begin   = End > Capacity ? End - Capacity : 0;
+		const uint64_t Valid   = Current + 1 > Capacity ? Current + 1 - Capacity : 0;
+
+		if (Valid > Begin)
+		{
+			const size_t Torn = static_cast<size_t>(std::min(Valid, End) - Begin);
+
+			Events.erase(Events.begin() + FirstEvent, Events.begin() + FirstEvent + Torn);
+		}
+	}
+
+
+// Constructors and Destructor:
+
+	FJobTracer::FJobTracer(size_t WorkerCount, size_t CapacityPerWorker)
+		: Origin (FJobTracer::Now())
+	{
+		Rings.reserve(WorkerCount);
+
+		for (size_t i = 0; i < WorkerCount; ++i)
+		{
+			Rings.push_back(std::make_unique<FJobTraceRing>(CapacityPerWorker));
+		}
+	}
+
+
+// Functions:
+
+	int64_t FJobTracer::Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	FJobTraceStats FJobTracer::GetStats() const
+	{
+		FJobTraceStats Stats;
+
+		std::vector<FJobTraceEvent> Events;
+		std::vector<int64_t>        BusyTimes;
+		std::vector<int64_t>        QueueWaits;
+
+		int64_t First = INT64_MAX;
+		int64_t Last  = INT64_MIN;
+
+		for (const auto& Ring : Rings)
+		{
+			Events.clear();
+
+			Ring->Snapshot(Events);
+
+			// A job run while another one helps or sits parked on a fiber lies within the outer span, only the union counts as busy.
+			std::sort(Events.begin(), Events.end(), [](const FJobTraceEvent& Left, const FJobTraceEvent& Right)
+				{
+					return Left.StartTime < Right.StartTime;
+				});
+
+			int64_t Busy         = 0;
+			int64_t CoveredUntil = INT64_MIN;
+
+			for (const FJobTraceEvent& Event : Events)
+			{
+				if (Event.EndTime > CoveredUntil)
+				{
+					Busy        += Event.EndTime - std::max(Event.StartTime, CoveredUntil);
+					CoveredUntil = Event.EndTime;
+				}
+
+				First = std::min(First, Event.StartTime);
+				Last  = std::max(Last, Event.EndTime);
+
+				if (Event.EnqueueTime != 0)
+				{
+					QueueWaits.push_back(Event.StartTime - Event.EnqueueTime);
+				}
+			}
+
+			Stats.JobCount += Events.size();
+
+			BusyTimes.push_back(Busy);
+		}
+
+		const double Window = Last > First ? static_cast<double>(Last - First) : 0.0;
+
+		for (int64_t Busy : BusyTimes)
+		{
+			Stats.WorkerUtilization.push_back(Window > 0.0 ? static_cast<double>(Busy) / Window : 0.0);
+		}
+
+		if (!QueueWaits.empty())
+		{
+			std::sort(QueueWaits.begin(), QueueWaits.end());
+
+			Stats.QueueWaitP50 = QueueWaits[QueueWaits.size() / 2];
+			Stats.QueueWaitP99 = QueueWaits[std::min(QueueWaits.size() - 1, QueueWaits.size() * 99 / 100)];
+		}
+
+		return Stats;
+	}
+
+	void FJobTracer::WriteChromeTrace(std::ostream& Stream) const
+	{
+		std::vector<FJobTraceEvent> Events;
+
+		char Number[32];
+
+		// Microseconds relative to the tracer's creation, with nanosecond digits.
+		auto WriteTime = [&](int64_t Nanoseconds)
+			{
+				std::snprintf(Number, sizeof(Number), "%.3f", static_cast<double>(Nanoseconds) / 1e3);
+
+				Stream << Number;
+			};
+
+		Stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+		bool b_First = true;
+
+		for (size_t Worker = 0; Worker < Rings.size(); ++Worker)
+		{
+			Stream << (b_First ? "\n" : ",\n");
+
+			b_First = false;
+
+			Stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << Worker << ",\"args\":{\"name\":\"Worker " << Worker << "\"}}";
+
+			Events.clear();
+
+			Rings[Worker]->Snapshot(Events);
+
+			for (const FJobTraceEvent& Event : Events)
+			{
+				Stream << ",\n{\"name\":";
+
+				WriteJsonString(Stream, Event.Name ? Event.Name : "Job");
+
+				Stream << ",\"cat\":\"job\",\"ph\":\"X\",\"pid\":0,\"tid\":" << Worker << ",\"ts\":";
+
+				WriteTime(Event.StartTime - Origin);
+
+				Stream << ",\"dur\":";
+
+				WriteTime(Event.EndTime - Event.StartTime);
+
+				if (Event.EnqueueTime != 0)
+				{
+					Stream << ",\"args\":{\"queue_wait_us\":";
+
+					WriteTime(Event.StartTime - Event.EnqueueTime);
+
+					Stream << '}';
+				}
+
+				Stream << '}';
+			}
+		}
+
+		Stream << "\n]}\n";
+	}
+
+	bool FJobTracer::ExportChromeTrace(const char* Path) const
+	{
+		std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+
+		if (!File)
+		{
+			return false;
+		}
+
+		this->WriteChromeTrace(File);
+
+		return static_cast<bool>(File);
+	}
+
+
+// Accessors:
+
+	FJobTraceRing& FJobTracer::GetRing(size_t WorkerIndex)
+	{
+		assert(WorkerIndex < Rings.size() && "Worker index out of range!");
+
+		return *Rings[WorkerIndex];
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace t3d
+{
+	// Timestamps are steady clock nanoseconds.
+	struct FJobTraceEvent
+	{
+		const char* Name;
+		int64_t     EnqueueTime;
+		int64_t     StartTime;
+		int64_t     EndTime;
+	};
+
+	struct FJobTraceStats
+	{
+		size_t              JobCount                 = 0;
+		std::vector<double> WorkerUtilization;
+		int64_t             QueueWaitP50             = 0;
+		int64_t             QueueWaitP99             = 0;
+		int64_t             QueueFullWaitNanoseconds = 0;
+	};
+
+	// Fixed-size ring, written by its worker only. Old events are overwritten once it is full.
+	class FJobTraceRing
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		explicit FJobTraceRing (size_t Capacity);
+		        ~FJobTraceRing () = default;
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// Owner only.
+		void Record(const FJobTraceEvent& Event);
+
+		// Any thread. Events overwritten while copying are left out.
+		void Snapshot(std::vector<FJobTraceEvent>& Events) const;
+
+	private:
+
+		struct FSlot
+		{
+			std::atomic<const char*> Name;
+			std::atomic<int64_t>     EnqueueTime;
+			std::atomic<int64_t>     StartTime;
+			std::atomic<int64_t>     EndTime;
+		};
+
+	// Variables:
+
+		std::unique_ptr<FSlot[]>          Slots;
+		uint64_t                          Mask;
+		alignas(64) std::atomic<uint64_t> WriteIndex;
+	};
+
+	// Per-worker job timelines: how long jobs sat in a queue, when and where they ran.
+	class FJobTracer
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		 FJobTracer (size_t WorkerCount, size_t CapacityPerWorker);
+		~FJobTracer () = default;
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		static int64_t Now();
+
+		// Wall time covered by the recorded events, QueueFullWaitNanoseconds is filled in by FJobSystem::GetTraceStats.
+		FJobTraceStats GetStats() const;
+
+		// Chrome trace_event JSON, open it in chrome://tracing or ui.perfetto.dev.
+		void WriteChromeTrace  (std::ostream& Stream) const;
+		bool ExportChromeTrace (const char* Path) const;
+
+	// Accessors:
+
+		FJobTraceRing& GetRing (size_t WorkerIndex);
+
+	private:
+
+	// Variables:
+
+		int64_t                                     Origin;
+		std::vector<std::unique_ptr<FJobTraceRing>> Rings;
+	};
+
+//	constexpr size_t Size = sizeof(FJobTracer);
+}
\ No newline at end of file
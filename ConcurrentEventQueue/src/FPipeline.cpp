@@ -0,0 +1,283 @@
+#include "FPipeline.h"
+#include "FJobSystem.h"
+
+#include <cassert>
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FPipeline::FPipeline(FJobSystem& InJobSystem, uint32_t InTokenCount, EJobPriority InPriority)
+		: JobSystem     (InJobSystem)
+		, TokenCount    (InTokenCount)
+		, Priority      (InPriority)
+		, Sequences     (new uint64_t[InTokenCount]())
+		, NextSequence  (0)
+		, InFlightCount (0)
+		, b_Reading     (false)
+		, b_InputDone   (false)
+	{
+		assert(TokenCount > 0 && "Pipeline needs at least one token!");
+
+		FreeTokens.reserve(TokenCount);
+	}
+
+	FPipeline::~FPipeline()
+	{
+		// Derived pipelines wait in their own destructor, their stages are already gone by now.
+		assert(!this->IsRunning() && "Pipeline destroyed while running!");
+	}
+
+
+// Functions:
+
+	JobHandle_T<void> FPipeline::Run()
+	{
+		assert(!this->IsRunning() && "Pipeline is already running!");
+
+		for (std::unique_ptr<FStage>& Stage : Stages)
+		{
+			Stage->NextSequence = 0;
+		}
+
+		FreeTokens.clear();
+
+		// Lowest token on top, so short streams stay in the first slots.
+		for (uint32_t Token = TokenCount; Token-- > 0;)
+		{
+			FreeTokens.push_back(Token);
+		}
+
+		NextSequence  = 0;
+		InFlightCount = 0;
+		b_Reading     = true;
+		b_InputDone   = false;
+		Handle        = MakeJobHandle<void>();
+
+		JobHandle_T<void> Result = Handle;
+
+		this->Spawn([this]() { this->ReadNext(); });
+
+		return Result;
+	}
+
+	void FPipeline::Wait()
+	{
+		if (Handle)
+		{
+			Handle->Wait();
+		}
+	}
+
+
+// Accessors:
+
+	bool FPipeline::IsRunning() const
+	{
+		return Handle && !Handle->IsReady();
+	}
+
+	uint32_t FPipeline::GetTokenCount() const
+	{
+		return TokenCount;
+	}
+
+	size_t FPipeline::GetStageCount() const
+	{
+		return Stages.size();
+	}
+
+
+// Protected Functions:
+
+	void FPipeline::AddStage(EPipelineStage Kind)
+	{
+		Stages.emplace_back(new FStage())->Kind = Kind;
+	}
+
+
+// Private Functions:
+
+	template<typename Functor_T>
+	void FPipeline::Spawn(Functor_T&& Job)
+	{
+		JobSystem.Submit(Job_T(TDetachedJob<std::decay_t<Functor_T>>::Create(JobSystem.GetJobPool(), std::forward<Functor_T>(Job))), Priority);
+	}
+
+	void FPipeline::ReadNext()
+	{
+		uint32_t Token = NoToken;
+
+		{
+			std::scoped_lock<std::mutex> Lock(InputMutex);
+
+			assert(b_Reading && "Pipeline input runs twice at once!");
+
+			Token = FreeTokens.back();
+
+			FreeTokens.pop_back();
+
+			++InFlightCount;
+		}
+
+		// b_Reading keeps other threads from spawning a second reader, so the input runs outside the lock.
+		const bool b_Item = this->ReadInput(Token);
+
+		if (b_Item)
+		{
+			Sequences[Token] = NextSequence++;
+		}
+
+		bool b_ReadOn   = false;
+		bool b_Finished = false;
+
+		{
+			std::scoped_lock<std::mutex> Lock(InputMutex);
+
+			if (!b_Item)
+			{
+				FreeTokens.push_back(Token);
+
+				--InFlightCount;
+
+				b_InputDone = true;
+			}
+
+			// Out of tokens, whoever returns one restarts the input.
+			b_ReadOn   = !b_InputDone && !FreeTokens.empty();
+			b_Reading  = b_ReadOn;
+			b_Finished = b_InputDone && InFlightCount == 0;
+		}
+
+		if (b_ReadOn)
+		{
+			this->Spawn([this]() { this->ReadNext(); });
+		}
+
+		if (b_Item)
+		{
+			this->Process(Token, 0, false);
+		}
+		else if (b_Finished)
+		{
+			this->Finish();
+		}
+	}
+
+	void FPipeline::Process(uint32_t Token, size_t Stage, bool b_Entered)
+	{
+		for (; Stage < Stages.size(); ++Stage, b_Entered = false)
+		{
+			FStage& Current = *Stages[Stage];
+
+			if (Current.Kind == EPipelineStage::Parallel)
+			{
+				this->RunStage(Stage, Token);
+
+				continue;
+			}
+
+			if (!b_Entered && !this->EnterStage(Current, Token))
+			{
+				return;
+			}
+
+			this->RunStage(Stage, Token);
+
+			// The item that was waiting longest carries on in its own job, this one moves to the next stage.
+			const uint32_t Waiting = this->LeaveStage(Current);
+
+			if (Waiting != NoToken)
+			{
+				this->Spawn([this, Waiting, Stage]() { this->Process(Waiting, Stage, true); });
+			}
+		}
+
+		this->ReleaseToken(Token);
+	}
+
+	bool FPipeline::EnterStage(FStage& Stage, uint32_t Token)
+	{
+		std::scoped_lock<std::mutex> Lock(Stage.Mutex);
+
+		if (Stage.b_Busy || (Stage.Kind == EPipelineStage::SerialInOrder && Sequences[Token] != Stage.NextSequence))
+		{
+			Stage.Waiting.push_back(Token);
+
+			return false;
+		}
+
+		Stage.b_Busy = true;
+
+		return true;
+	}
+
+	uint32_t FPipeline::LeaveStage(FStage& Stage)
+	{
+		std::scoped_lock<std::mutex> Lock(Stage.Mutex);
+
+		++Stage.NextSequence;
+
+		// At most TokenCount items wait, a scan for the oldest one is cheap.
+		size_t Oldest = Stage.Waiting.size();
+
+		for (size_t i = 0; i < Stage.Waiting.size(); ++i)
+		{
+			if (Oldest == Stage.Waiting.size() || Sequences[Stage.Waiting[i]] < Sequences[Stage.Waiting[Oldest]])
+			{
+				Oldest = i;
+			}
+		}
+
+		if (Oldest == Stage.Waiting.size() || (Stage.Kind == EPipelineStage::SerialInOrder && Sequences[Stage.Waiting[Oldest]] != Stage.NextSequence))
+		{
+			Stage.b_Busy = false;
+
+			return NoToken;
+		}
+
+		const uint32_t Token = Stage.Waiting[Oldest];
+
+		Stage.Waiting[Oldest] = Stage.Waiting.back();
+
+		Stage.Waiting.pop_back();
+
+		return Token;
+	}
+
+	void FPipeline::Finish()
+	{
+		// Whoever waits on the handle may destroy the pipeline right away, don't touch it after signaling.
+		JobHandle_T<void> Done = Handle;
+
+		Done->Signal();
+	}
+
+	void FPipeline::ReleaseToken(uint32_t Token)
+	{
+		bool b_ReadOn   = false;
+		bool b_Finished = false;
+
+		{
+			std::scoped_lock<std::mutex> Lock(InputMutex);
+
+			FreeTokens.push_back(Token);
+
+			--InFlightCount;
+
+			b_ReadOn   = !b_Reading && !b_InputDone;
+			b_Reading  = b_Reading || b_ReadOn;
+			b_Finished = b_InputDone && InFlightCount == 0;
+		}
+
+		if (b_ReadOn)
+		{
+			this->Spawn([this]() { this->ReadNext(); });
+		}
+		else if (b_Finished)
+		{
+			this->Finish();
+		}
+	}
+
+}
\ No newline at end of file
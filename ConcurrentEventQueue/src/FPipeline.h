@@ -0,0 +1,179 @@
+#pragma once
+
+#include "TJobHandle.h"
+#include "FJobQueue.h"
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace t3d
+{
+	class FJobSystem;
+
+	enum class EPipelineStage : uint8_t
+	{
+		// Any number of items at once.
+		Parallel,
+
+		// One item at a time, in the order the input produced them.
+		SerialInOrder,
+
+		// One item at a time, in whatever order they arrive.
+		SerialOutOfOrder
+	};
+
+	// Streams items from a serial input through a chain of stages on the job system.
+	// Each item owns one of TokenCount slots from input to the end of the last stage, the input stops reading while all slots are in flight.
+	// A job carries its item down the stages until a serial stage is busy, the item then waits there and the stage picks it up when it frees up.
+	class FPipeline
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		         FPipeline (FJobSystem& InJobSystem, uint32_t InTokenCount, EJobPriority InPriority = EJobPriority::Normal);
+		virtual ~FPipeline ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// The handle signals once the input is exhausted and the last item has left the last stage.
+		JobHandle_T<void> Run  ();
+		void              Wait ();
+
+	// Accessors:
+
+		bool     IsRunning     () const;
+		uint32_t GetTokenCount () const;
+		size_t   GetStageCount () const;
+
+	protected:
+
+	// Interface:
+
+		// Fills the slot of Token, false once the input is exhausted. Never runs concurrently with itself.
+		virtual bool ReadInput (uint32_t Token) = 0;
+		virtual void RunStage  (size_t Stage, uint32_t Token) = 0;
+
+	// Functions:
+
+		void AddStage(EPipelineStage Kind);
+
+	private:
+
+		static constexpr uint32_t NoToken = UINT32_MAX;
+
+		struct FStage
+		{
+			EPipelineStage        Kind;
+			std::mutex            Mutex;
+			bool                  b_Busy       = false;
+			uint64_t              NextSequence = 0;
+			std::vector<uint32_t> Waiting;
+		};
+
+	// Private Functions:
+
+		template<typename Functor_T>
+		void     Spawn        (Functor_T&& Job);
+		void     ReadNext     ();
+		void     Process      (uint32_t Token, size_t Stage, bool b_Entered);
+		bool     EnterStage   (FStage& Stage, uint32_t Token);
+		uint32_t LeaveStage   (FStage& Stage);
+		void     ReleaseToken (uint32_t Token);
+		void     Finish       ();
+
+	// Variables:
+
+		FJobSystem&                          JobSystem;
+		const uint32_t                       TokenCount;
+		const EJobPriority                   Priority;
+		std::vector<std::unique_ptr<FStage>> Stages;
+		std::unique_ptr<uint64_t[]>          Sequences;
+		std::mutex                           InputMutex;
+		std::vector<uint32_t>                FreeTokens;
+		uint64_t                             NextSequence;
+		uint32_t                             InFlightCount;
+		bool                                 b_Reading;
+		bool                                 b_InputDone;
+		JobHandle_T<void>                    Handle;
+	};
+
+	// Pipeline over TokenCount reused Item_T slots. The input overwrites whatever the slot held for the previous item,
+	// so buffers inside Item_T keep their capacity from item to item.
+	template<typename Item_T>
+	class TPipeline : public FPipeline
+	{
+		static_assert(std::is_default_constructible_v<Item_T>, "Pipeline item slots are created up front!");
+
+	public:
+
+	// Constructors and Destructor:
+
+		TPipeline(FJobSystem& InJobSystem, uint32_t InTokenCount, EJobPriority InPriority = EJobPriority::Normal)
+			: FPipeline (InJobSystem, InTokenCount, InPriority)
+			, Items     (new Item_T[InTokenCount])
+		{}
+
+		~TPipeline()
+		{
+			this->Wait();
+		}
+
+	// Functions:
+
+		// Stage is called as void(Item_T&). Stages are fixed while the pipeline runs.
+		template<typename Functor_T>
+		TPipeline& AddStage(EPipelineStage Kind, Functor_T&& Stage)
+		{
+			assert(!this->IsRunning() && "Pipeline stages can't change while it runs!");
+
+			StageFunctors.emplace_back(std::forward<Functor_T>(Stage));
+
+			FPipeline::AddStage(Kind);
+
+			return *this;
+		}
+
+		// Input is called as bool(Item_T&), serially and in order.
+		template<typename Functor_T>
+		JobHandle_T<void> Run(Functor_T&& InInput)
+		{
+			assert(!this->IsRunning() && "Pipeline is already running!");
+
+			Input = std::forward<Functor_T>(InInput);
+
+			return FPipeline::Run();
+		}
+
+	protected:
+
+		bool ReadInput(uint32_t Token) override
+		{
+			return Input(Items[Token]);
+		}
+
+		void RunStage(size_t Stage, uint32_t Token) override
+		{
+			StageFunctors[Stage](Items[Token]);
+		}
+
+	private:
+
+	// Variables:
+
+		std::function<bool(Item_T&)>              Input;
+		std::vector<std::function<void(Item_T&)>> StageFunctors;
+		std::unique_ptr<Item_T[]>                 Items;
+	};
+
+//	constexpr size_t Size = sizeof(FPipeline);
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "FRealtimeWorker.h"
+#include "FWorkerThread.h"
+#include "FAtomicLock.h"
+
+#include <cassert>
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FRealtimeWorker::FRealtimeWorker(FJobSystem* InJobSystem, uint32_t InIndex, int32_t InCore, uint32_t ScratchSize)
+		: JobSystem (InJobSystem)
+		, Index     (InIndex)
+		, Core      (InCore)
+		, b_Running (false)
+		, Scratch   (ScratchSize)
+	{}
+
+	FRealtimeWorker::~FRealtimeWorker()
+	{
+		if (ExecutionThread.joinable())
+		{
+			this->Stop();
+		}
+	}
+
+
+// Functions:
+
+	void FRealtimeWorker::Launch()
+	{
+		assert(!ExecutionThread.joinable() && "Thread is already launched!");
+
+		b_Running.store(true);
+
+		ExecutionThread = std::thread(&FRealtimeWorker::ExecuteJobs, this);
+	}
+
+	void FRealtimeWorker::Stop()
+	{
+		assert(ExecutionThread.joinable() && "Thread is not running!");
+
+		b_Running.store(false);
+
+		ExecutionThread.join();
+	}
+
+	void FRealtimeWorker::Submit(Job_T&& Job)
+	{
+		Jobs.Push(Job.release());
+	}
+
+
+// Accessors:
+
+	bool FRealtimeWorker::IsRunning() const
+	{
+		return b_Running.load();
+	}
+
+	uint32_t FRealtimeWorker::GetIndex() const
+	{
+		return Index;
+	}
+
+	int32_t FRealtimeWorker::GetCore() const
+	{
+		return Core;
+	}
+
+
+// Private Functions:
+
+	void FRealtimeWorker::ExecuteJobs()
+	{
+		CurrentWorkerIndex     = Index;
+		CurrentWorkerJobSystem = JobSystem;
+
+		FScratchArena::SetCurrent(&Scratch);
+
+		if (Core >= 0)
+		{
+			const bool b_Pinned = PinThreadToCore(Core);
+
+			assert(b_Pinned && "Failed to pin realtime worker thread!");
+
+			(void)b_Pinned;
+		}
+
+		while (b_Running.load(std::memory_order_relaxed) || !Jobs.IsEmpty())
+		{
+			// Polls with a plain load, the queue's cache line stays shared with the producers until there is something to take.
+			if (Jobs.IsEmpty())
+			{
+				CpuRelax();
+
+				continue;
+			}
+
+			IJob* ReadBuffer = Jobs.TakeAll();
+
+			while (ReadBuffer)
+			{
+				Job_T Job(ReadBuffer);
+
+				ReadBuffer = ReadBuffer->NextJob;
+
+				FScratchArena::FScope Scope(Scratch);
+
+				Job->Execute();
+			}
+		}
+
+		FScratchArena::SetCurrent(nullptr);
+
+		CurrentWorkerIndex     = NoWorkerIndex;
+		CurrentWorkerJobSystem = nullptr;
+	}
+
+}
\ No newline at end of file
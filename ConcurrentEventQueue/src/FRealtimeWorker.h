@@ -0,0 +1,63 @@
+#pragma once
+
+#include "IJob.h"
+#include "TIntrusiveMpscQueue.h"
+#include "FScratchArena.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace t3d
+{
+	class FJobSystem;
+
+	// Worker for jobs with deadlines in the microseconds, see FJobSystem::ScheduleRealtime. It busy-polls its queue
+	// and never parks, so a submission costs one push and no wake-up, at the price of a core spinning for good.
+	// Nothing else runs here: it doesn't steal and no other worker steals from it.
+	class FRealtimeWorker
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		 FRealtimeWorker (FJobSystem* InJobSystem = nullptr, uint32_t InIndex = 0, int32_t InCore = -1, uint32_t ScratchSize = 64 * 1024);
+		~FRealtimeWorker ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		void Launch ();
+		void Stop   ();
+		void Submit (Job_T&& Job);
+
+	// Accessors:
+
+		bool     IsRunning () const;
+		uint32_t GetIndex  () const;
+		int32_t  GetCore   () const;
+
+	private:
+
+	// Private Functions:
+
+		void ExecuteJobs ();
+
+	// Variables:
+
+		// Continuations of its jobs go to this system's regular workers.
+		FJobSystem*                               JobSystem;
+
+		// Slot for TPerWorker, it comes after the job system's regular workers.
+		uint32_t                                  Index;
+		int32_t                                   Core;
+		TIntrusiveMpscQueue<IJob, &IJob::NextJob> Jobs;
+		std::thread                               ExecutionThread;
+		std::atomic<bool>                         b_Running;
+		FScratchArena                             Scratch;
+	};
+
+//	constexpr size_t Size = sizeof(FRealtimeWorker);
+}
\ No newline at end of file
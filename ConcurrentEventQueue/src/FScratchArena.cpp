@@ -0,0 +1,209 @@
+#include "FScratchArena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <new>
+
+namespace t3d
+{
+	static thread_local FScratchArena* CurrentArena = nullptr;
+
+// Constructors and Destructor:
+
+	FScratchArena::FScratchArena(size_t InInitialSize)
+		: Current     (nullptr)
+		, Cursor      (nullptr)
+		, End         (nullptr)
+		, Spare       (nullptr)
+		, InitialSize (std::max<size_t>(InInitialSize, 1024))
+	{}
+
+	FScratchArena::~FScratchArena()
+	{
+		this->FreeBlocks();
+	}
+
+
+// Functions:
+
+	void FScratchArena::Rewind(const FMarker& Marker)
+	{
+		// Blocks grown since the marker are kept aside, so the next job that needs them doesn't allocate again.
+		while (Current != Marker.Block)
+		{
+			assert(Current && "Marker belongs to another arena or was rewound already!");
+
+			FBlock* Block = Current;
+
+			Current         = Block->Previous;
+			Block->Previous = Spare;
+			Spare           = Block;
+		}
+
+		Cursor = Marker.Cursor;
+		End    = Current ? Current->GetData() + Current->Capacity : nullptr;
+	}
+
+	void FScratchArena::Reset()
+	{
+		size_t Capacity   = 0;
+		size_t BlockCount = 0;
+
+		for (FBlock* Chain : { Current, Spare })
+		{
+			for (FBlock* Block = Chain; Block; Block = Block->Previous)
+			{
+				Capacity += Block->Capacity;
+
+				++BlockCount;
+			}
+		}
+
+		if (BlockCount == 0)
+		{
+			return;
+		}
+
+		if (BlockCount > 1)
+		{
+			this->FreeBlocks();
+
+			this->PushBlock(NewBlock(Capacity));
+
+			return;
+		}
+
+		if (!Current)
+		{
+			FBlock* Block = Spare;
+
+			Spare = nullptr;
+
+			Block->Previous = nullptr;
+
+			this->PushBlock(Block);
+
+			return;
+		}
+
+		Cursor = Current->GetData();
+		End    = Cursor + Current->Capacity;
+	}
+
+
+// Accessors:
+
+	size_t FScratchArena::GetUsedSize() const
+	{
+		if (!Current)
+		{
+			return 0;
+		}
+
+		size_t Used = static_cast<size_t>(Cursor - Current->GetData());
+
+		for (FBlock* Block = Current->Previous; Block; Block = Block->Previous)
+		{
+			Used += Block->Capacity;
+		}
+
+		return Used;
+	}
+
+	size_t FScratchArena::GetCapacity() const
+	{
+		size_t Capacity = 0;
+
+		for (FBlock* Chain : { Current, Spare })
+		{
+			for (FBlock* Block = Chain; Block; Block = Block->Previous)
+			{
+				Capacity += Block->Capacity;
+			}
+		}
+
+		return Capacity;
+	}
+
+	FScratchArena& FScratchArena::GetCurrent()
+	{
+		if (CurrentArena)
+		{
+			return *CurrentArena;
+		}
+
+		static thread_local FScratchArena ThreadArena;
+
+		return ThreadArena;
+	}
+
+	void FScratchArena::SetCurrent(FScratchArena* Arena)
+	{
+		CurrentArena = Arena;
+	}
+
+
+// Private Functions:
+
+	void* FScratchArena::AllocateSlow(size_t Size, size_t Alignment)
+	{
+		assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0 && "Alignment has to be a power of two!");
+
+		const size_t Needed = Size + Alignment;
+
+		// The rest of the current block is skipped, it comes back with the next Rewind or Reset.
+		for (FBlock** Link = &Spare; *Link; Link = &(*Link)->Previous)
+		{
+			if ((*Link)->Capacity >= Needed)
+			{
+				FBlock* Block = *Link;
+
+				*Link = Block->Previous;
+
+				this->PushBlock(Block);
+
+				return this->Allocate(Size, Alignment);
+			}
+		}
+
+		this->PushBlock(NewBlock(std::max(Current ? Current->Capacity * 2 : InitialSize, Needed)));
+
+		return this->Allocate(Size, Alignment);
+	}
+
+	void FScratchArena::PushBlock(FBlock* Block)
+	{
+		Block->Previous = Current;
+
+		Current = Block;
+		Cursor  = Block->GetData();
+		End     = Cursor + Block->Capacity;
+	}
+
+	void FScratchArena::FreeBlocks()
+	{
+		for (FBlock* Chain : { Current, Spare })
+		{
+			while (Chain)
+			{
+				FBlock* Block = Chain;
+
+				Chain = Block->Previous;
+
+				::operator delete(Block);
+			}
+		}
+
+		Current = nullptr;
+		Spare   = nullptr;
+		Cursor  = nullptr;
+		End     = nullptr;
+	}
+
+	FScratchArena::FBlock* FScratchArena::NewBlock(size_t Capacity)
+	{
+		return new (::operator new(sizeof(FBlock) + Capacity)) FBlock{ nullptr, Capacity };
+	}
+
+}
\ No newline at end of file
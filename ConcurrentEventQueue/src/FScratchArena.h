@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace t3d
+{
+	// Linear allocator for job-local temporaries: an allocation is a pointer bump, nothing is freed one by one.
+	// Each worker owns one. It reclaims a job's scratch once the job is done, or everything on FJobSystem::EndFrame()
+	// if FJobSystemConfig::b_ScratchPerFrame is set. Destructors never run, so only trivially destructible data goes here.
+	class FScratchArena
+	{
+	public:
+
+		struct FMarker
+		{
+			void*      Block  = nullptr;
+			std::byte* Cursor = nullptr;
+		};
+
+		// Gives back everything allocated in its lifetime when it goes out of scope.
+		class FScope
+		{
+		public:
+
+			explicit FScope (FScratchArena& InArena) : Arena(InArena), Marker(InArena.GetMarker()) {}
+			        ~FScope ()                       { Arena.Rewind(Marker); }
+
+			// No copy
+			// No move
+
+		private:
+
+			FScratchArena& Arena;
+			FMarker        Marker;
+		};
+
+	// Constructors and Destructor:
+
+		// Nothing is allocated up front, the first block is InitialSize bytes.
+		explicit FScratchArena (size_t InInitialSize = 64 * 1024);
+		        ~FScratchArena ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t))
+		{
+			const uintptr_t Aligned = (reinterpret_cast<uintptr_t>(Cursor) + Alignment - 1) & ~static_cast<uintptr_t>(Alignment - 1);
+
+			if (Cursor == nullptr || Aligned + Size > reinterpret_cast<uintptr_t>(End))
+			{
+				return this->AllocateSlow(Size, Alignment);
+			}
+
+			Cursor = reinterpret_cast<std::byte*>(Aligned + Size);
+
+			return reinterpret_cast<void*>(Aligned);
+		}
+
+		// Uninitialized storage for Count objects.
+		template<typename T>
+		T* Allocate(size_t Count = 1)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "Scratch memory is reclaimed without running destructors!");
+
+			return static_cast<T*>(this->Allocate(sizeof(T) * Count, alignof(T)));
+		}
+
+		FMarker GetMarker() const
+		{
+			return FMarker{ Current, Cursor };
+		}
+
+		// Frees everything allocated since Marker was taken. Blocks grown since then are kept for later allocations.
+		void Rewind (const FMarker& Marker);
+
+		// Frees everything. A chain of grown blocks is merged into one of their total size, so the next cycle doesn't grow again.
+		void Reset  ();
+
+	// Accessors:
+
+		size_t GetUsedSize     () const;
+
+		// Every block the arena holds, in use or kept for later.
+		size_t GetCapacity     () const;
+
+		// The arena of the worker running the calling thread. Other threads get one of their own, which only
+		// FScope or jobs the thread runs itself give back.
+		static FScratchArena& GetCurrent ();
+		static void           SetCurrent (FScratchArena* Arena);
+
+	private:
+
+		struct alignas(std::max_align_t) FBlock
+		{
+			FBlock* Previous;
+			size_t  Capacity;
+
+			std::byte* GetData()
+			{
+				return reinterpret_cast<std::byte*>(this + 1);
+			}
+		};
+
+	// Private Functions:
+
+		void*       AllocateSlow (size_t Size, size_t Alignment);
+		void        PushBlock    (FBlock* Block);
+		void        FreeBlocks   ();
+
+		static FBlock* NewBlock (size_t Capacity);
+
+	// Variables:
+
+		FBlock*    Current;
+		std::byte* Cursor;
+		std::byte* End;
+
+		// Blocks given back by Rewind, linked through Previous. AllocateSlow takes from here before it allocates.
+		FBlock*    Spare;
+		size_t     InitialSize;
+	};
+
+//	constexpr size_t Size = sizeof(FScratchArena);
+}
\ No newline at end of file
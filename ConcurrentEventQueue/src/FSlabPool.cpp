@@ -0,0 +1,215 @@
+#include "FSlabPool.h"
+
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace t3d
+{
+	struct FSlabPool::FStore
+	{
+		static constexpr size_t   BlockStride = sizeof(FBlockHeader) + BlockSize;
+		static constexpr uint64_t IndexMask   = 0xFFFFFFFFull;
+
+	// Constructors and Destructor:
+
+		FStore()
+			: FreeHead   (0)
+			, References (1)
+			, Slabs      (new std::atomic<std::byte*>[MaxSlabCount]())
+			, SlabCount  (0)
+		{}
+
+		~FStore()
+		{
+			const uint32_t Count = SlabCount.load();
+
+			for (uint32_t i = 0; i < Count; ++i)
+			{
+				::operator delete(Slabs[i].load(), std::align_val_t(64));
+			}
+		}
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		void Release()
+		{
+			if (References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				delete this;
+			}
+		}
+
+		FBlockHeader* PopFree()
+		{
+			uint64_t Head = FreeHead.load(std::memory_order_acquire);
+
+			while (Head & IndexMask)
+			{
+				FBlockHeader* Block = this->GetBlock(static_cast<uint32_t>(Head & IndexMask) - 1);
+
+				// May read a stale link if the block was popped meanwhile, the tag makes the CAS below fail then.
+				const uint64_t Next    = Block->NextFree.load(std::memory_order_relaxed);
+				const uint64_t NewHead = ((Head & ~IndexMask) + (IndexMask + 1)) | Next;
+
+				if (FreeHead.compare_exchange_weak(Head, NewHead, std::memory_order_acquire, std::memory_order_acquire))
+				{
+					return Block;
+				}
+			}
+
+			return nullptr;
+		}
+
+		void PushFree(FBlockHeader* Block)
+		{
+			uint64_t Head = FreeHead.load(std::memory_order_relaxed);
+			uint64_t NewHead;
+
+			do
+			{
+				Block->NextFree.store(static_cast<uint32_t>(Head & IndexMask), std::memory_order_relaxed);
+
+				NewHead = ((Head & ~IndexMask) + (IndexMask + 1)) | (static_cast<uint64_t>(Block->Index) + 1);
+			}
+			while (!FreeHead.compare_exchange_weak(Head, NewHead, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		bool Grow()
+		{
+			std::scoped_lock<std::mutex> Lock(GrowMutex);
+
+			// Somebody else grew the pool or freed a block while we were waiting.
+			if (FreeHead.load(std::memory_order_acquire) & IndexMask)
+			{
+				return true;
+			}
+
+			const uint32_t SlabIndex = SlabCount.load(std::memory_order_relaxed);
+
+			if (SlabIndex == MaxSlabCount)
+			{
+				return false;
+			}
+
+			std::byte* Slab = static_cast<std::byte*>(::operator new(BlockStride * BlocksPerSlab, std::align_val_t(64)));
+
+			Slabs[SlabIndex].store(Slab, std::memory_order_release);
+
+			SlabCount.store(SlabIndex + 1, std::memory_order_release);
+
+			for (uint32_t i = 0; i < BlocksPerSlab; ++i)
+			{
+				FBlockHeader* Block = new (Slab + i * BlockStride) FBlockHeader{ this, {0}, static_cast<uint32_t>(SlabIndex * BlocksPerSlab + i) };
+
+				this->PushFree(Block);
+			}
+
+			return true;
+		}
+
+	// Accessors:
+
+		FBlockHeader* GetBlock(uint32_t Index) const
+		{
+			std::byte* Slab = Slabs[Index / BlocksPerSlab].load(std::memory_order_acquire);
+
+			assert(Slab && "Free list points into a slab that does not exist!");
+
+			return reinterpret_cast<FBlockHeader*>(Slab + (Index % BlocksPerSlab) * BlockStride);
+		}
+
+	// Variables:
+
+		// Low half: index of the first free block plus one, zero when empty. High half: ABA tag.
+		// Every allocation and free touches both, so they share a line.
+		alignas(64) std::atomic<uint64_t>          FreeHead;
+		std::atomic<uint64_t>                      References;
+		std::unique_ptr<std::atomic<std::byte*>[]> Slabs;
+		std::atomic<uint32_t>                      SlabCount;
+		std::mutex                                 GrowMutex;
+	};
+
+
+// Constructors and Destructor:
+
+	FSlabPool::FSlabPool()
+		: Store (new FStore())
+	{}
+
+	FSlabPool::~FSlabPool()
+	{
+		Store->Release();
+	}
+
+
+// Functions:
+
+	void* FSlabPool::Allocate(size_t Size)
+	{
+		FBlockHeader* Block = nullptr;
+
+		if (Size <= BlockSize)
+		{
+			Block = Store->PopFree();
+
+			while (!Block && Store->Grow())
+			{
+				Block = Store->PopFree();
+			}
+		}
+
+		// Too large, or the pool hit MaxSlabCount.
+		if (!Block)
+		{
+			return AllocateUnpooled(Size);
+		}
+
+		Store->References.fetch_add(1, std::memory_order_relaxed);
+
+		return Block + 1;
+	}
+
+	void* FSlabPool::AllocateUnpooled(size_t Size)
+	{
+		FBlockHeader* Block = new (::operator new(sizeof(FBlockHeader) + Size)) FBlockHeader{ nullptr, {0}, 0 };
+
+		return Block + 1;
+	}
+
+	void FSlabPool::Free(void* Memory)
+	{
+		if (!Memory)
+		{
+			return;
+		}
+
+		FBlockHeader* Block = static_cast<FBlockHeader*>(Memory) - 1;
+
+		if (FStore* Owner = Block->Owner)
+		{
+			Owner->PushFree(Block);
+
+			Owner->Release();
+		}
+		else
+		{
+			Block->~FBlockHeader();
+
+			::operator delete(Block);
+		}
+	}
+
+
+// Accessors:
+
+	size_t FSlabPool::GetSlabCount() const
+	{
+		return Store->SlabCount.load(std::memory_order_relaxed);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace t3d
+{
+	// Fixed-size block pool. Any thread may allocate or free, the free list is a tagged lock-free stack.
+	// Requests that do not fit a block fall back to the heap, so callers never need to check the size themselves.
+	// Blocks may outlive the pool, e.g. a job handle kept past its job system: the slabs go once the last block is freed.
+	class FSlabPool
+	{
+	public:
+
+		static constexpr size_t BlockSize     = 240;
+		static constexpr size_t BlockAlign    = 16;
+		static constexpr size_t BlocksPerSlab = 256;
+		static constexpr size_t MaxSlabCount  = 4096;
+
+	// Constructors and Destructor:
+
+		 FSlabPool ();
+		~FSlabPool ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		void*        Allocate         (size_t Size);
+		static void* AllocateUnpooled (size_t Size);
+		static void  Free             (void* Memory);
+
+	// Accessors:
+
+		size_t GetSlabCount () const;
+
+	private:
+
+		// Slabs and free list, defined in FSlabPool.cpp. One reference for the pool and one per allocated block.
+		struct FStore;
+
+		struct alignas(BlockAlign) FBlockHeader
+		{
+			FStore*               Owner;
+			std::atomic<uint32_t> NextFree;
+			uint32_t              Index;
+		};
+
+	// Variables:
+
+		FStore* Store;
+	};
+
+//	constexpr size_t Size = sizeof(FSlabPool);
+}
\ No newline at end of file
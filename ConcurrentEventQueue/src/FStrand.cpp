@@ -0,0 +1,95 @@
+#include "FStrand.h"
+#include "FJobSystem.h"
+
+#include <cassert>
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FStrand::FStrand(FJobSystem& InJobSystem, EJobPriority InPriority, uint32_t InQuantum)
+		: JobSystem    (InJobSystem)
+		, Priority     (InPriority)
+		, Quantum      (InQuantum > 0 ? InQuantum : 1)
+		, PendingCount (0)
+		, Backlog      (nullptr)
+	{}
+
+	FStrand::~FStrand()
+	{
+		assert(this->IsIdle() && "Strand destroyed with jobs still queued!");
+	}
+
+
+// Functions:
+
+	void FStrand::Submit(Job_T&& Job)
+	{
+		Mailbox.Push(Job.release());
+
+		// Counted after the push, so a drain job that sees the count also finds the job.
+		if (PendingCount.fetch_add(1, std::memory_order_acq_rel) == 0)
+		{
+			this->SubmitDrain();
+		}
+	}
+
+
+// Accessors:
+
+	bool FStrand::IsIdle() const
+	{
+		return PendingCount.load(std::memory_order_acquire) == 0;
+	}
+
+
+// Private Functions:
+
+	void FStrand::Drain()
+	{
+		for (uint32_t Ran = 1;; ++Ran)
+		{
+			if (!Backlog)
+			{
+				Backlog = Mailbox.TakeAll();
+
+				assert(Backlog && "Strand counted a job that never arrived!");
+			}
+
+			Job_T Job(Backlog);
+
+			Backlog = Job->NextJob;
+
+			Job->Execute();
+
+			Job.reset();
+
+			// Backlog may hold jobs whose producer hasn't counted them yet. It stays for the next drain job,
+			// which the producer submits once it takes the count off zero.
+			if (PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				return;
+			}
+
+			if (Ran == Quantum)
+			{
+				this->SubmitDrain();
+
+				return;
+			}
+		}
+	}
+
+	void FStrand::SubmitDrain()
+	{
+		auto Drain = [this]() { this->Drain(); };
+
+		JobSystem.Submit(Job_T(TDetachedJob<decltype(Drain)>::Create(this->GetJobPool(), Drain)), Priority);
+	}
+
+	FSlabPool& FStrand::GetJobPool()
+	{
+		return JobSystem.GetJobPool();
+	}
+
+}
\ No newline at end of file
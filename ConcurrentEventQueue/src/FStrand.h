@@ -0,0 +1,82 @@
+#pragma once
+
+#include "TJob.h"
+#include "FJobQueue.h"
+#include "TIntrusiveMpscQueue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace t3d
+{
+	class FJobSystem;
+
+	// Runs its jobs one at a time and in submission order, but on whichever worker is free, not on a pinned one.
+	// Jobs wait in a lock-free mailbox. The first job posted to an idle strand submits a drain job that works through
+	// the mailbox, so a strand costs nothing while idle and thousands of them can share the pool.
+	class FStrand
+	{
+	public:
+
+		// Jobs a drain job runs before it requeues itself, so a busy strand doesn't hold on to its worker for good.
+		static constexpr uint32_t DefaultQuantum = 64;
+
+	// Constructors and Destructor:
+
+		explicit FStrand (FJobSystem& InJobSystem, EJobPriority InPriority = EJobPriority::Normal, uint32_t InQuantum = DefaultQuantum);
+		        ~FStrand ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		template<typename Functor_T>
+		JobHandle_T<std::invoke_result_t<Functor_T>> Schedule(Functor_T&& Job, const char* Name = nullptr)
+		{
+			using Return_T = std::invoke_result_t<Functor_T>;
+
+			auto* InternalJob = TJob<Return_T, std::decay_t<Functor_T>>::Create(this->GetJobPool(), std::forward<Functor_T>(Job));
+
+			JobHandle_T<Return_T> Handle = InternalJob->GetHandle();
+
+			InternalJob->Name = Name;
+
+			this->Submit(Job_T(InternalJob));
+
+			return Handle;
+		}
+
+		void Submit(Job_T&& Job);
+
+	// Accessors:
+
+		// Nothing queued or running.
+		bool IsIdle() const;
+
+	private:
+
+	// Private Functions:
+
+		void       Drain       ();
+		void       SubmitDrain ();
+		FSlabPool& GetJobPool  ();
+
+	// Variables:
+
+		FJobSystem&                               JobSystem;
+		const EJobPriority                        Priority;
+		const uint32_t                            Quantum;
+		TIntrusiveMpscQueue<IJob, &IJob::NextJob> Mailbox;
+
+		// Jobs posted but not run yet. Whoever takes it off zero submits the drain job.
+		alignas(64) std::atomic<uint32_t>         PendingCount;
+
+		// Taken from the mailbox but not run yet, only the drain job touches it.
+		IJob*                                     Backlog;
+	};
+
+//	constexpr size_t Size = sizeof(FStrand);
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "FTimerThread.h"
+#include "FJobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FTimerThread::FTimerThread(FJobSystem* InJobSystem, std::chrono::nanoseconds InResolution)
+		: JobSystem         (InJobSystem)
+		, Resolution        (std::max(InResolution, std::chrono::nanoseconds(1)))
+		, Origin            (std::chrono::steady_clock::now())
+		, MaintenancePeriod (std::chrono::nanoseconds::zero())
+		, WakeTick          (UINT64_MAX)
+		, b_Running         (false)
+	{}
+
+	FTimerThread::~FTimerThread()
+	{
+		if (b_Running)
+		{
+			this->Stop();
+		}
+
+		Wheel.Clear([](void* Payload) { DestroyTask(static_cast<ITimerTask*>(Payload)); });
+	}
+
+
+// Functions:
+
+	void FTimerThread::Launch(std::chrono::nanoseconds InMaintenancePeriod)
+	{
+		assert(!b_Running && "Timer thread is already launched!");
+
+		b_Running         = true;
+		MaintenancePeriod = InMaintenancePeriod;
+
+		ExecutionThread = std::thread(&FTimerThread::ExecuteTimers, this);
+	}
+
+	void FTimerThread::Stop()
+	{
+		assert(b_Running && "Timer thread is not running!");
+
+		{
+			std::scoped_lock<std::mutex> Lock(WheelMutex);
+
+			b_Running = false;
+		}
+
+		WheelCondition.notify_one();
+
+		ExecutionThread.join();
+	}
+
+	bool FTimerThread::Cancel(FTimerId Id)
+	{
+		ITimerTask* Task = nullptr;
+
+		{
+			std::scoped_lock<std::mutex> Lock(WheelMutex);
+
+			Task = static_cast<ITimerTask*>(Wheel.Cancel(Id));
+		}
+
+		if (!Task)
+		{
+			return false;
+		}
+
+		DestroyTask(Task);
+
+		return true;
+	}
+
+
+// Accessors:
+
+	size_t FTimerThread::GetPendingCount() const
+	{
+		std::scoped_lock<std::mutex> Lock(WheelMutex);
+
+		return Wheel.GetCount();
+	}
+
+
+// Private Functions:
+
+	FTimerId FTimerThread::AddTask(ITimerTask* Task, std::chrono::nanoseconds Delay, std::chrono::nanoseconds Period)
+	{
+		const uint64_t PeriodTicks = Period.count() > 0 ? static_cast<uint64_t>(std::max<int64_t>(1, (Period.count() + Resolution.count() - 1) / Resolution.count())) : 0;
+
+		FTimerId Id;
+
+		bool b_Earlier = false;
+
+		{
+			std::scoped_lock<std::mutex> Lock(WheelMutex);
+
+			const auto     Elapsed = std::chrono::steady_clock::now() - Origin;
+			const uint64_t Now     = static_cast<uint64_t>(Elapsed / Resolution);
+
+			// An idle wheel may lag behind, catch it up so it doesn't walk all the ticks in between later.
+			if (Wheel.GetCount() == 0)
+			{
+				Wheel.Advance(Now, [](void*, bool) {});
+			}
+
+			// Round up, a timer never fires early.
+			const uint64_t Deadline = std::max(Now + 1, static_cast<uint64_t>((Elapsed + Delay + Resolution - std::chrono::nanoseconds(1)) / Resolution));
+
+			Id = Wheel.Add(Deadline, PeriodTicks, Task);
+
+			b_Earlier = Deadline < WakeTick;
+		}
+
+		// The timer thread sleeps past the new deadline.
+		if (b_Earlier)
+		{
+			WheelCondition.notify_one();
+		}
+
+		return Id;
+	}
+
+	void FTimerThread::ExecuteTimers()
+	{
+		constexpr size_t LevelCount = static_cast<size_t>(EJobPriority::Count);
+
+		std::vector<IJob*> Fired[LevelCount];
+
+		using Clock_T = std::chrono::steady_clock;
+
+		const bool b_Maintenance = MaintenancePeriod > std::chrono::nanoseconds::zero();
+
+		Clock_T::time_point NextMaintenance = Clock_T::now() + MaintenancePeriod;
+
+		std::unique_lock<std::mutex> Lock(WheelMutex);
+
+		while (b_Running)
+		{
+			if (b_Maintenance && Clock_T::now() >= NextMaintenance)
+			{
+				Lock.unlock();
+
+				JobSystem->ScaleWorkers();
+
+				Lock.lock();
+
+				NextMaintenance = Clock_T::now() + MaintenancePeriod;
+
+				continue;
+			}
+
+			bool b_Fired = false;
+
+			Wheel.Advance(this->GetCurrentTick(), [&](void* Payload, bool b_Last)
+				{
+					ITimerTask* Task = static_cast<ITimerTask*>(Payload);
+
+					Fired[static_cast<size_t>(Task->Priority)].push_back(Task->CreateJob(JobPool, b_Last));
+
+					if (b_Last)
+					{
+						DestroyTask(Task);
+					}
+
+					b_Fired = true;
+				});
+
+			if (b_Fired)
+			{
+				// Submitting may wake workers, don't hold up producers meanwhile.
+				Lock.unlock();
+
+				for (size_t Level = 0; Level < LevelCount; ++Level)
+				{
+					JobSystem->SubmitBatch(Fired[Level].data(), Fired[Level].size(), static_cast<EJobPriority>(Level));
+
+					Fired[Level].clear();
+				}
+
+				Lock.lock();
+
+				continue;
+			}
+
+			WakeTick = Wheel.GetNextEventTick();
+
+			if (WakeTick == UINT64_MAX && !b_Maintenance)
+			{
+				WheelCondition.wait(Lock);
+			}
+			else if (WakeTick == UINT64_MAX)
+			{
+				WheelCondition.wait_until(Lock, NextMaintenance);
+			}
+			else
+			{
+				const Clock_T::time_point Deadline = Origin + Resolution * WakeTick;
+
+				WheelCondition.wait_until(Lock, b_Maintenance ? std::min(Deadline, NextMaintenance) : Deadline);
+			}
+
+			WakeTick = UINT64_MAX;
+		}
+	}
+
+	uint64_t FTimerThread::GetCurrentTick() const
+	{
+		return static_cast<uint64_t>((std::chrono::steady_clock::now() - Origin) / Resolution);
+	}
+
+	void FTimerThread::DestroyTask(ITimerTask* Task)
+	{
+		Task->~ITimerTask();
+
+		FSlabPool::Free(Task);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "TJob.h"
+#include "FJobQueue.h"
+#include "FTimerWheel.h"
+
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace t3d
+{
+	class FJobSystem;
+
+	// What a timer holds on to until it fires: the functor and the priority its jobs run at.
+	class ITimerTask
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		         ITimerTask (EJobPriority InPriority) : Priority(InPriority) {}
+		virtual ~ITimerTask () = default;
+
+	// Interface:
+
+		// b_Last hands the functor over, otherwise the job gets a copy for this period.
+		virtual IJob* CreateJob (FSlabPool& Pool, bool b_Last) = 0;
+
+	// Variables:
+
+		const EJobPriority Priority;
+	};
+
+	template<typename Functor_T>
+	class TTimerTask : public ITimerTask
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		template<typename Arg_T>
+		TTimerTask(Arg_T&& InFunctor, EJobPriority InPriority)
+			: ITimerTask (InPriority)
+			, Functor    (std::forward<Arg_T>(InFunctor))
+		{}
+
+	// Functions:
+
+		IJob* CreateJob(FSlabPool& Pool, bool b_Last) override
+		{
+			if constexpr (std::is_copy_constructible_v<Functor_T>)
+			{
+				if (!b_Last)
+				{
+					return TDetachedJob<Functor_T>::Create(Pool, Functor);
+				}
+			}
+
+			// Move-only functors only come from one-shot timers, FJobSystem::ScheduleEvery rejects them.
+			assert(b_Last && "Periodic timer with a functor that can't be copied!");
+
+			return TDetachedJob<Functor_T>::Create(Pool, std::move(Functor));
+		}
+
+	private:
+
+		Functor_T Functor;
+	};
+
+	// Services an FTimerWheel on its own thread and hands expired timers to the job system as jobs.
+	class FTimerThread
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		 FTimerThread (FJobSystem* InJobSystem, std::chrono::nanoseconds InResolution);
+		~FTimerThread ();
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// A non-zero MaintenancePeriod also lets the job system resize its worker pool that often, see FJobSystem::ScaleWorkers.
+		void Launch (std::chrono::nanoseconds InMaintenancePeriod = std::chrono::nanoseconds::zero());
+		void Stop   ();
+
+		// Period zero fires once.
+		template<typename Functor_T>
+		FTimerId Add(std::chrono::nanoseconds Delay, std::chrono::nanoseconds Period, EJobPriority Priority, Functor_T&& Job)
+		{
+			using Task_T = TTimerTask<std::decay_t<Functor_T>>;
+
+			static_assert(alignof(Task_T) <= FSlabPool::BlockAlign, "Over-aligned functors are not supported by FSlabPool!");
+
+			ITimerTask* Task = new (JobPool.Allocate(sizeof(Task_T))) Task_T(std::forward<Functor_T>(Job), Priority);
+
+			return this->AddTask(Task, Delay, Period);
+		}
+
+		// A job the timer has already handed out still runs, only later ones are stopped.
+		bool Cancel(FTimerId Id);
+
+	// Accessors:
+
+		size_t GetPendingCount () const;
+
+	private:
+
+	// Private Functions:
+
+		FTimerId AddTask        (ITimerTask* Task, std::chrono::nanoseconds Delay, std::chrono::nanoseconds Period);
+		void     ExecuteTimers  ();
+		uint64_t GetCurrentTick () const;
+
+		static void DestroyTask (ITimerTask* Task);
+
+	// Variables:
+
+		FSlabPool                                   JobPool;
+		FJobSystem*                                 JobSystem;
+		const std::chrono::nanoseconds              Resolution;
+		const std::chrono::steady_clock::time_point Origin;
+		std::chrono::nanoseconds                    MaintenancePeriod;
+		mutable std::mutex                          WheelMutex;
+		std::condition_variable                     WheelCondition;
+		FTimerWheel                                 Wheel;
+		uint64_t                                    WakeTick;
+		bool                                        b_Running;
+		std::thread                                 ExecutionThread;
+	};
+
+//	constexpr size_t Size = sizeof(FTimerThread);
+}
\ No newline at end of file
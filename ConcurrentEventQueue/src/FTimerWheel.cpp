@@ -0,0 +1,222 @@
+#include "FTimerWheel.h"
+
+#include <cassert>
+
+namespace t3d
+{
+// Constructors and Destructor:
+
+	FTimerWheel::FTimerWheel()
+		: CurrentTick (0)
+		, Count       (0)
+	{
+		std::fill(std::begin(Heads), std::end(Heads), UINT32_MAX);
+	}
+
+
+// Functions:
+
+	FTimerId FTimerWheel::Add(uint64_t Deadline, uint64_t Period, void* Payload)
+	{
+		uint32_t Index;
+
+		if (!FreeTimers.empty())
+		{
+			Index = FreeTimers.back();
+
+			FreeTimers.pop_back();
+		}
+		else
+		{
+			Index = static_cast<uint32_t>(Timers.size());
+
+			Timers.emplace_back();
+		}
+
+		FTimer& Timer = Timers[Index];
+
+		Timer.Deadline = Deadline;
+		Timer.Period   = Period;
+		Timer.Payload  = Payload;
+
+		this->Link(Index);
+
+		++Count;
+
+		return FTimerId{ Index, Timer.Generation };
+	}
+
+	void* FTimerWheel::Cancel(FTimerId Id)
+	{
+		if (Id.Index >= Timers.size() || Timers[Id.Index].Generation != Id.Generation || Timers[Id.Index].Slot == UINT32_MAX)
+		{
+			return nullptr;
+		}
+
+		void* Payload = Timers[Id.Index].Payload;
+
+		this->Unlink(Id.Index);
+		this->Release(Id.Index);
+
+		return Payload;
+	}
+
+
+// Accessors:
+
+	size_t FTimerWheel::GetCount() const
+	{
+		return Count;
+	}
+
+	uint64_t FTimerWheel::GetCurrentTick() const
+	{
+		return CurrentTick;
+	}
+
+	uint64_t FTimerWheel::GetNextEventTick() const
+	{
+		if (Count == 0)
+		{
+			return UINT64_MAX;
+		}
+
+		// A tick on a root boundary cascades before it fires anything.
+		const uint64_t NextCascade = (CurrentTick + RootSize - 1) & ~uint64_t(RootSize - 1);
+
+		for (uint64_t Tick = CurrentTick; Tick < NextCascade; ++Tick)
+		{
+			if (Heads[Tick & (RootSize - 1)] != UINT32_MAX)
+			{
+				return Tick;
+			}
+		}
+
+		return NextCascade;
+	}
+
+
+// Private Functions:
+
+	void FTimerWheel::Link(uint32_t Index)
+	{
+		FTimer& Timer = Timers[Index];
+
+		// Overdue timers go to the slot that is processed next.
+		const uint64_t Deadline = std::max(Timer.Deadline, CurrentTick);
+		const uint64_t Delta    = Deadline - CurrentTick;
+
+		uint32_t Slot;
+
+		if (Delta < RootSize)
+		{
+			Slot = static_cast<uint32_t>(Deadline & (RootSize - 1));
+		}
+		else
+		{
+			// Too far out for the last level: park it at the far end, it gets re-linked when that slot cascades.
+			const uint64_t Placed = Delta > MaxDelta ? CurrentTick + MaxDelta : Deadline;
+			const uint64_t Span   = Placed - CurrentTick;
+
+			uint32_t Level = 1;
+
+			while (Level < LevelCount && Span >= (1ull << (RootBits + Level * LevelBits)))
+			{
+				++Level;
+			}
+
+			const uint32_t Shift = RootBits + (Level - 1) * LevelBits;
+
+			Slot = RootSize + (Level - 1) * LevelSize + static_cast<uint32_t>((Placed >> Shift) & (LevelSize - 1));
+		}
+
+		Timer.Slot     = Slot;
+		Timer.Previous = UINT32_MAX;
+		Timer.Next     = Heads[Slot];
+
+		if (Timer.Next != UINT32_MAX)
+		{
+			Timers[Timer.Next].Previous = Index;
+		}
+
+		Heads[Slot] = Index;
+	}
+
+	void FTimerWheel::Unlink(uint32_t Index)
+	{
+		FTimer& Timer = Timers[Index];
+
+		if (Timer.Previous != UINT32_MAX)
+		{
+			Timers[Timer.Previous].Next = Timer.Next;
+		}
+		else
+		{
+			Heads[Timer.Slot] = Timer.Next;
+		}
+
+		if (Timer.Next != UINT32_MAX)
+		{
+			Timers[Timer.Next].Previous = Timer.Previous;
+		}
+
+		Timer.Slot     = UINT32_MAX;
+		Timer.Previous = UINT32_MAX;
+		Timer.Next     = UINT32_MAX;
+	}
+
+	uint32_t FTimerWheel::Detach(uint32_t Slot)
+	{
+		const uint32_t Head = Heads[Slot];
+
+		Heads[Slot] = UINT32_MAX;
+
+		for (uint32_t Index = Head; Index != UINT32_MAX; Index = Timers[Index].Next)
+		{
+			Timers[Index].Slot = UINT32_MAX;
+		}
+
+		return Head;
+	}
+
+	void FTimerWheel::Cascade()
+	{
+		// Each level only cascades once the one below it has wrapped around as well.
+		for (uint32_t Level = 1; Level <= LevelCount; ++Level)
+		{
+			const uint32_t Shift  = RootBits + (Level - 1) * LevelBits;
+			const uint32_t Bucket = static_cast<uint32_t>((CurrentTick >> Shift) & (LevelSize - 1));
+
+			uint32_t Index = this->Detach(RootSize + (Level - 1) * LevelSize + Bucket);
+
+			while (Index != UINT32_MAX)
+			{
+				const uint32_t Next = Timers[Index].Next;
+
+				this->Link(Index);
+
+				Index = Next;
+			}
+
+			if (Bucket != 0)
+			{
+				break;
+			}
+		}
+	}
+
+	void FTimerWheel::Release(uint32_t Index)
+	{
+		FTimer& Timer = Timers[Index];
+
+		Timer.Payload = nullptr;
+		Timer.Slot    = UINT32_MAX;
+
+		++Timer.Generation;
+
+		FreeTimers.push_back(Index);
+
+		--Count;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace t3d
+{
+	struct FTimerId
+	{
+		uint32_t Index      = UINT32_MAX;
+		uint32_t Generation = 0;
+
+		bool IsValid() const
+		{
+			return Index != UINT32_MAX;
+		}
+	};
+
+	// Hierarchical timing wheel: 256 one-tick slots, then three levels of 64 slots, each slot 64 times wider than
+	// one slot of the level below. Timers cascade down a level when the level below wraps around.
+	// Insert and cancel are O(1), timers further out than the last level are parked there and cascade again.
+	// Not thread-safe, FTimerThread guards it.
+	class FTimerWheel
+	{
+	public:
+
+		static constexpr uint32_t RootBits   = 8;
+		static constexpr uint32_t LevelBits  = 6;
+		static constexpr uint32_t LevelCount = 3;
+		static constexpr uint32_t RootSize   = 1u << RootBits;
+		static constexpr uint32_t LevelSize  = 1u << LevelBits;
+		static constexpr uint64_t MaxDelta   = (1ull << (RootBits + LevelCount * LevelBits)) - 1;
+
+		struct FTimer
+		{
+			uint64_t Deadline   = 0;
+			uint64_t Period     = 0;
+			void*    Payload    = nullptr;
+			uint32_t Previous   = UINT32_MAX;
+			uint32_t Next       = UINT32_MAX;
+			uint32_t Generation = 0;
+			uint32_t Slot       = UINT32_MAX;
+		};
+
+	// Constructors and Destructor:
+
+		 FTimerWheel ();
+		~FTimerWheel () = default;
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// Deadline in ticks, timers that are already due fire on the next tick. Period 0 fires once.
+		FTimerId Add    (uint64_t Deadline, uint64_t Period, void* Payload);
+
+		// Returns the payload, or nullptr if the timer has already fired for the last time or was cancelled.
+		void*    Cancel (FTimerId Id);
+
+		// Processes every tick up to and including Now. Fire(void* Payload, bool b_Last) runs for each expired timer,
+		// periodic timers are re-armed one period after their deadline.
+		template<typename Fire_T>
+		void Advance(uint64_t Now, Fire_T&& Fire)
+		{
+			if (Count == 0)
+			{
+				CurrentTick = std::max(CurrentTick, Now + 1);
+
+				return;
+			}
+
+			for (; CurrentTick <= Now; ++CurrentTick)
+			{
+				const uint32_t RootIndex = static_cast<uint32_t>(CurrentTick & (RootSize - 1));
+
+				if (RootIndex == 0)
+				{
+					this->Cascade();
+				}
+
+				uint32_t Index = this->Detach(RootIndex);
+
+				while (Index != UINT32_MAX)
+				{
+					FTimer&        Timer = Timers[Index];
+					const uint32_t Next  = Timer.Next;
+
+					if (Timer.Period == 0)
+					{
+						void* Payload = Timer.Payload;
+
+						this->Release(Index);
+
+						Fire(Payload, true);
+					}
+					else
+					{
+						Fire(Timer.Payload, false);
+
+						// Missed periods are dropped rather than fired back to back.
+						FTimer& Rearmed = Timers[Index];
+
+						Rearmed.Deadline = std::max(Rearmed.Deadline + Rearmed.Period, CurrentTick + 1);
+
+						this->Link(Index);
+					}
+
+					Index = Next;
+				}
+			}
+		}
+
+		// Drops every pending timer, Release(void* Payload) runs for each one.
+		template<typename Release_T>
+		void Clear(Release_T&& Release)
+		{
+			for (uint32_t Index = 0; Index < Timers.size(); ++Index)
+			{
+				if (Timers[Index].Slot != UINT32_MAX)
+				{
+					void* Payload = Timers[Index].Payload;
+
+					this->Unlink(Index);
+					this->Release(Index);
+
+					Release(Payload);
+				}
+			}
+		}
+
+	// Accessors:
+
+		size_t   GetCount         () const;
+		uint64_t GetCurrentTick   () const;
+
+		// Earliest tick anything may need to happen on: a root slot with timers or the next cascade.
+		uint64_t GetNextEventTick () const;
+
+	private:
+
+	// Private Functions:
+
+		void     Link    (uint32_t Index);
+		void     Unlink  (uint32_t Index);
+		uint32_t Detach  (uint32_t Slot);
+		void     Cascade ();
+		void     Release (uint32_t Index);
+
+	// Variables:
+
+		std::vector<FTimer>   Timers;
+		std::vector<uint32_t> FreeTimers;
+		uint32_t              Heads[RootSize + LevelCount * LevelSize];
+		uint64_t              CurrentTick;
+		size_t                Count;
+	};
+
+//	constexpr size_t Size = sizeof(FTimerWheel);
+}
\ No newline at end of file
@@ -1,20 +1,158 @@
 #include "FWorkerThread.h"
+#include "FJobSystem.h"
 
 #include <cassert>
 
+#if defined _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#elif defined __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace t3d
 {
+	static thread_local FWorkerThread* CurrentWorker = nullptr;
+
+	bool HelpWhileWaiting()
+	{
+		FWorkerThread* Worker = CurrentWorker;
+
+		if (!Worker || !Worker->b_HelpWhileWaiting || Worker->HelpDepth >= FWorkerThread::MaxHelpDepth)
+		{
+			return false;
+		}
+
+		Job_T Job;
+
+		if (!Worker->FindJob(Job))
+		{
+			return false;
+		}
+
+		++Worker->HelpDepth;
+
+		Worker->RunJob(Job);
+
+		--Worker->HelpDepth;
+
+		return true;
+	}
+
+	bool ParkFiberUntilReady(FJobHandleBase& Handle)
+	{
+		FWorkerThread* Worker = CurrentWorker;
+
+		FFiber* Fiber = Worker ? Worker->CurrentFiber : nullptr;
+
+		if (!Fiber)
+		{
+			return false;
+		}
+
+		// The worker registers the fiber with the handle once nothing runs on this stack anymore, see SwitchToFiber.
+		Fiber->WaitingOn = &Handle;
+
+		Fiber->Suspend();
+
+		return true;
+	}
+
+	FSlabPool* GetCurrentJobPool()
+	{
+		return CurrentWorker ? &CurrentWorker->GetJobPool() : nullptr;
+	}
+
+	void SubmitContinuation(IJob* Job, FJobSystem* JobSystem)
+	{
+		// A realtime worker hands it to the regular workers of its system, it only runs ScheduleRealtime jobs itself.
+		if (!JobSystem)
+		{
+			JobSystem = CurrentWorkerJobSystem;
+		}
+
+		if (JobSystem)
+		{
+			JobSystem->Submit(Job_T(Job));
+
+			return;
+		}
+
+		if (FWorkerThread* Worker = CurrentWorker)
+		{
+			Worker->Submit(Job_T(Job));
+
+			return;
+		}
+
+		// No job system to hand it to: Then() without one, attached or signaled outside any worker.
+		Job_T Inline(Job);
+
+		FScratchArena::FScope Scope(FScratchArena::GetCurrent());
+
+		Inline->Execute();
+	}
+
+	bool PinThreadToCore(int32_t Core)
+	{
+#if defined _WIN32
+		return Core < static_cast<int32_t>(sizeof(DWORD_PTR) * 8) && SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << Core) != 0;
+#elif defined __linux__
+		cpu_set_t CpuSet;
+
+		CPU_ZERO(&CpuSet);
+		CPU_SET(Core, &CpuSet);
+
+		return pthread_setaffinity_np(pthread_self(), sizeof(CpuSet), &CpuSet) == 0;
+#else
+		(void)Core;
+
+		return false;
+#endif
+	}
+
+
 // Constructors and Destructor:
 
-	FWorkerThread::FWorkerThread()
-		: LaunchSemaphore (false)
-		, StopSemaphore   (false)
-		, b_Running       (false)
+	FWorkerThread::FWorkerThread(FJobSystem* InJobSystem, uint32_t InIndex, int32_t InCore)
+		: JobSystem          (InJobSystem)
+		, Index              (InIndex)
+		, Core               (InCore)
+		, HighJobs           (InJobSystem ? InJobSystem->GetConfig().JobQueueCapacity : FJobQueue::DefaultCapacity)
+		, BackgroundJobs     (InJobSystem ? InJobSystem->GetConfig().JobQueueCapacity : FJobQueue::DefaultCapacity)
+		, LaunchSemaphore    (false)
+		, StopSemaphore      (false)
+		, b_Running          (false)
+		, b_Busy             (false)
+		, VictimSeed         ((InIndex + 1) * 2654435761u)
+		, AgingThreshold     (InJobSystem ? InJobSystem->GetConfig().AgingThreshold : FJobSystemConfig().AgingThreshold)
+		, StarvedPicks       {}
+		, IdleSpinCount      (InJobSystem ? InJobSystem->GetConfig().IdleSpinCount : FJobSystemConfig().IdleSpinCount)
+		, b_HelpWhileWaiting (InJobSystem ? InJobSystem->GetConfig().b_HelpWhileWaiting : false)
+		, HelpDepth          (0)
+		, TraceRing          (InJobSystem && InJobSystem->Tracer ? &InJobSystem->Tracer->GetRing(InIndex) : nullptr)
+		, FiberCount         (InJobSystem ? InJobSystem->GetConfig().FiberCount : 0)
+		, FiberStackSize     (InJobSystem ? InJobSystem->GetConfig().FiberStackSize : FJobSystemConfig().FiberStackSize)
+		, CurrentFiber       (nullptr)
+		, ParkedFiberCount   (0)
+		, QueueFullPolicy    (InJobSystem ? InJobSystem->GetConfig().QueueFullPolicy : EJobQueueFull::Wait)
+		, Scratch            (InJobSystem ? InJobSystem->GetConfig().ScratchSize : FJobSystemConfig().ScratchSize)
+		, b_ScratchPerFrame  (InJobSystem ? InJobSystem->GetConfig().b_ScratchPerFrame : false)
+		, ScratchFrame       (0)
+		, b_CanRetire        (InJobSystem ? InIndex >= InJobSystem->GetConfig().MinWorkerCount : false)
+		, b_Launched         (false)
+		, b_RetireRequested  (false)
+		, b_Retiring         (false)
+		, Pins               (0)
+		, InboxCount         (0)
+		, IdleSince          (0)
 	{}
 
 	FWorkerThread::~FWorkerThread()
 	{
-		if (b_Running.load())
+		if (b_Launched)
 		{
 			this->Stop();
 		}
@@ -27,8 +165,20 @@ namespace t3d
 	{
 		assert(b_Running.load() == false && "Thread is already launched!");
 
+		// Relaunched after retiring, wait until the old thread is gone.
+		if (b_Launched)
+		{
+			StopSemaphore.acquire();
+		}
+
 		b_Running.store(true);
 
+		b_Launched = true;
+
+		b_RetireRequested.store(false);
+		b_Retiring.store(false);
+		IdleSince.store(FJobTracer::Now());
+
 		ExecutionThread = std::thread(&FWorkerThread::ExecuteJobs, this);
 
 		ExecutionThread.detach();
@@ -38,11 +188,163 @@ namespace t3d
 
 	void FWorkerThread::Stop()
 	{
-		assert(b_Running.load() && "Thread is not running!");
+		assert(b_Launched && "Thread is not running!");
+
+		// A retired worker's thread is on its way out already, only the semaphore is left to collect.
+		while (b_Running.load())
+		{
+			if (this->TryPin())
+			{
+				this->Schedule([this]() { b_Running.store(false); });
 
-		this->Schedule([this]() { b_Running.store(false); });
+				this->Unpin();
+
+				break;
+			}
+
+			std::this_thread::yield();
+		}
 
 		StopSemaphore.acquire();
+
+		b_Launched = false;
+	}
+
+	void FWorkerThread::Submit(Job_T&& Job, EJobPriority Priority)
+	{
+		if (TraceRing)
+		{
+			Job->EnqueueTime = FJobTracer::Now();
+		}
+
+		switch (Priority)
+		{
+			case EJobPriority::High:
+			{
+				this->SubmitBounded(HighJobs, std::move(Job));
+
+				break;
+			}
+
+			case EJobPriority::Background:
+			{
+				this->SubmitBounded(BackgroundJobs, std::move(Job));
+
+				break;
+			}
+
+			default:
+			{
+				if (CurrentWorker == this)
+				{
+					LocalJobs.Push(Job.release());
+				}
+				else
+				{
+					InboxCount.fetch_add(1, std::memory_order_relaxed);
+
+					Inbox.Push(Job.release());
+				}
+
+				break;
+			}
+		}
+
+		if (CurrentWorker != this)
+		{
+			ExecutionLock.Release();
+		}
+	}
+
+	void FWorkerThread::SubmitBatch(IJob* const* Jobs, size_t Count, EJobPriority Priority)
+	{
+		if (Count == 0)
+		{
+			return;
+		}
+
+		if (TraceRing)
+		{
+			const int64_t Now = FJobTracer::Now();
+
+			for (size_t i = 0; i < Count; ++i)
+			{
+				Jobs[i]->EnqueueTime = Now;
+			}
+		}
+
+		switch (Priority)
+		{
+			case EJobPriority::High:
+			{
+				this->SubmitBoundedBatch(HighJobs, Jobs, Count);
+
+				break;
+			}
+
+			case EJobPriority::Background:
+			{
+				this->SubmitBoundedBatch(BackgroundJobs, Jobs, Count);
+
+				break;
+			}
+
+			default:
+			{
+				if (CurrentWorker == this)
+				{
+					for (size_t i = 0; i < Count; ++i)
+					{
+						LocalJobs.Push(Jobs[i]);
+					}
+
+					break;
+				}
+
+				InboxCount.fetch_add(static_cast<uint32_t>(Count), std::memory_order_relaxed);
+
+				// Link newest first and publish the whole chain with a single exchange.
+				Jobs[0]->NextJob = nullptr;
+
+				for (size_t i = 1; i < Count; ++i)
+				{
+					Jobs[i]->NextJob = Jobs[i - 1];
+				}
+
+				Inbox.PushChain(Jobs[Count - 1], Jobs[0]);
+
+				break;
+			}
+		}
+
+		if (CurrentWorker != this)
+		{
+			ExecutionLock.Release();
+		}
+	}
+
+	bool FWorkerThread::Steal(Job_T& Job, EJobPriority Priority)
+	{
+		if (Priority != EJobPriority::Normal)
+		{
+			return this->TakeLocal(Priority, Job);
+		}
+
+		IJob* Stolen = nullptr;
+
+		if (LocalJobs.Steal(Stolen))
+		{
+			Job.reset(Stolen);
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void FWorkerThread::Wake()
+	{
+		ExecutionLock.Release();
 	}
 
 
@@ -58,48 +360,597 @@ namespace t3d
 		return b_Busy.load();
 	}
 
+	uint32_t FWorkerThread::GetIndex() const
+	{
+		return Index;
+	}
+
+	int32_t FWorkerThread::GetCore() const
+	{
+		return Core;
+	}
+
+	FSlabPool& FWorkerThread::GetJobPool()
+	{
+		return JobPool;
+	}
+
+	FWorkerThread* FWorkerThread::GetCurrent()
+	{
+		return CurrentWorker;
+	}
+
 
 // Private Functions:
 
 	void FWorkerThread::ExecuteJobs()
 	{
+		CurrentWorker          = this;
+		CurrentWorkerIndex     = Index;
+		CurrentWorkerJobSystem = JobSystem;
+
+		FScratchArena::SetCurrent(&Scratch);
+
+		if (FiberCount > 0)
+		{
+			FFiber::ConvertThread();
+		}
+
+		this->PinToCore();
+
 		LaunchSemaphore.release();
 
-		std::vector<Job_T> ReadBuffer;
+		bool b_Retired = false;
 
-		while (b_Running.load() || !this->BufferIsEmpty(WriteBuffer))
+		while (b_Running.load() || this->HasPendingJobs())
 		{
-			ExecutionLock.Acquire();
+			ExecutionLock.Acquire(IdleSpinCount);
+
+			if (b_RetireRequested.exchange(false) && this->TryRetire())
+			{
+				b_Retired = true;
+
+				break;
+			}
 
 			b_Busy.store(true);
 
+			bool b_RanJobs = false;
+
+			while (this->ExecutePendingJobs())
 			{
-				std::scoped_lock<std::mutex> Lock(BufferMutex);
+				b_RanJobs = true;
+			}
 
-				std::swap(ReadBuffer, WriteBuffer);
+			// A wake-up that found nothing, e.g. a peer's job taken by somebody else first, doesn't count as work.
+			if (b_RanJobs)
+			{
+				IdleSince.store(FJobTracer::Now(), std::memory_order_relaxed);
 			}
 
-			for (auto& Job : ReadBuffer)
+			b_Busy.store(false);
+		}
+
+		assert(ParkedFiberCount == 0 && "Worker stopped with jobs still parked!");
+
+		// Fibers belong to this thread, a later launch starts a fresh set.
+		if (b_Retired)
+		{
+			FreeFibers.clear();
+			Fibers.clear();
+		}
+
+		if (FiberCount > 0)
+		{
+			FFiber::RevertThread();
+		}
+
+		FScratchArena::SetCurrent(nullptr);
+
+		CurrentWorker          = nullptr;
+		CurrentWorkerIndex     = NoWorkerIndex;
+		CurrentWorkerJobSystem = nullptr;
+
+		StopSemaphore.release();
+	}
+
+	bool FWorkerThread::TryRetire()
+	{
+		if (!b_CanRetire || !b_Running.load() || this->HasPendingJobs())
+		{
+			return false;
+		}
+
+		// Closes the door on producers, see TryPin. The ones already in finish their push first.
+		b_Retiring.store(true);
+
+		while (Pins.load() != 0)
+		{
+			std::this_thread::yield();
+		}
+
+		if (this->HasPendingJobs())
+		{
+			b_Retiring.store(false);
+
+			return false;
+		}
+
+		b_Running.store(false);
+
+		JobSystem->RunningWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+		JobSystem->RetireCount.fetch_add(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	// Producers outside the worker hold a pin while they push, so either the retiring worker sees their job or they see it retiring.
+	bool FWorkerThread::TryPin()
+	{
+		if (!b_CanRetire)
+		{
+			return true;
+		}
+
+		Pins.fetch_add(1);
+
+		if (!b_Retiring.load())
+		{
+			return true;
+		}
+
+		Pins.fetch_sub(1, std::memory_order_release);
+
+		return false;
+	}
+
+	void FWorkerThread::Unpin()
+	{
+		if (b_CanRetire)
+		{
+			Pins.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	void FWorkerThread::RunJob(Job_T& Job)
+	{
+		if (b_ScratchPerFrame)
+		{
+			this->ExecuteJob(Job);
+
+			return;
+		}
+
+		const FScratchArena::FMarker Marker = Scratch.GetMarker();
+
+		this->ExecuteJob(Job);
+
+		// Jobs nest on one stack, so a finished job's scratch sits on top, unless a parked fiber allocated after it.
+		// ReclaimScratch picks that up once nothing is parked anymore.
+		if (ParkedFiberCount == 0)
+		{
+			Scratch.Rewind(Marker);
+		}
+	}
+
+	void FWorkerThread::ExecuteJob(Job_T& Job)
+	{
+		// Fibers are only handed out from the worker's own stack. A job run from inside a fiber, e.g. while
+		// helping in ParallelFor, stays on that fiber and parks together with it.
+		if (FiberCount > 0 && !CurrentFiber)
+		{
+			FFiber* Fiber = nullptr;
+
+			if (!FreeFibers.empty())
 			{
+				Fiber = FreeFibers.back();
+
+				FreeFibers.pop_back();
+			}
+			else if (Fibers.size() < FiberCount)
+			{
+				Fiber = Fibers.emplace_back(std::make_unique<FFiber>(this, FiberStackSize)).get();
+			}
+
+			// Every fiber is parked, run on the worker's stack. Waits in this job block the worker again.
+			if (Fiber)
+			{
+				Fiber->Job       = std::move(Job);
+				Fiber->StartTime = TraceRing ? FJobTracer::Now() : 0;
+
+				this->SwitchToFiber(Fiber);
+
+				return;
+			}
+		}
+
+		if (!TraceRing)
+		{
+			Job->Execute();
+
+			return;
+		}
+
+		const int64_t StartTime = FJobTracer::Now();
+
+		Job->Execute();
+
+		TraceRing->Record(FJobTraceEvent{ Job->Name, Job->EnqueueTime, StartTime, FJobTracer::Now() });
+	}
+
+	// Runs on the worker's own stack right before a job starts, so a job queued after EndFrame() sees the new frame.
+	void FWorkerThread::ReclaimScratch()
+	{
+		if (b_ScratchPerFrame)
+		{
+			const uint64_t Frame = JobSystem ? JobSystem->FrameIndex.load(std::memory_order_acquire) : 0;
+
+			if (Frame == ScratchFrame)
+			{
+				return;
+			}
+
+			ScratchFrame = Frame;
+		}
+
+		// A parked job may still use its scratch. In per-frame mode the next boundary takes this frame's scratch along.
+		if (ParkedFiberCount == 0)
+		{
+			Scratch.Reset();
+		}
+	}
+
+	void FWorkerThread::SwitchToFiber(FFiber* Fiber)
+	{
+		// A job that parks leaves its handle behind in CurrentJobHandle, the next job must not see it.
+		const FJobHandleBase* Outer = CurrentJobHandle;
+
+		for (;;)
+		{
+			CurrentFiber = Fiber;
+
+			Fiber->Resume();
+
+			CurrentFiber     = nullptr;
+			CurrentJobHandle = Outer;
+
+			if (Fiber->b_Finished)
+			{
+				if (TraceRing)
+				{
+					TraceRing->Record(FJobTraceEvent{ Fiber->Job->Name, Fiber->Job->EnqueueTime, Fiber->StartTime, FJobTracer::Now() });
+				}
+
+				Fiber->b_Finished = false;
+
+				Fiber->Job.reset();
+
+				FreeFibers.push_back(Fiber);
+
+				return;
+			}
+
+			FJobHandleBase* Handle = Fiber->WaitingOn;
+
+			Fiber->WaitingOn = nullptr;
+
+			++ParkedFiberCount;
+
+			// From here on the fiber may be resumed through FFiber::Continue at any time.
+			if (Handle->AddContinuation(Fiber))
+			{
+				return;
+			}
+
+			// Signaled in the meantime, keep going.
+			--ParkedFiberCount;
+		}
+	}
+
+	void FWorkerThread::ResumeFiber(FFiber* Fiber)
+	{
+		ReadyFibers.Push(Fiber);
+
+		if (CurrentWorker != this)
+		{
+			ExecutionLock.Release();
+		}
+	}
+
+	bool FWorkerThread::ResumeReadyFibers()
+	{
+		if (ReadyFibers.IsEmpty())
+		{
+			return false;
+		}
+
+		FFiber* Fiber = ReadyFibers.TakeAll();
+
+		const bool b_Resumed = Fiber != nullptr;
+
+		while (Fiber)
+		{
+			FFiber* Next = Fiber->NextFiber;
+
+			Fiber->NextFiber = nullptr;
+
+			--ParkedFiberCount;
+
+			this->SwitchToFiber(Fiber);
+
+			Fiber = Next;
+		}
+
+		return b_Resumed;
+	}
+
+	void FWorkerThread::PinToCore()
+	{
+		if (Core < 0)
+		{
+			return;
+		}
+
+		const bool b_Pinned = PinThreadToCore(Core);
+
+		assert(b_Pinned && "Failed to pin worker thread!");
+
+		(void)b_Pinned;
+	}
+
+	bool FWorkerThread::ExecutePendingJobs()
+	{
+		// Parked jobs that can go on first, they already hold on to resources.
+		bool b_Executed = this->ResumeReadyFibers();
+
+		IJob* ReadBuffer = WriteQueue.TakeAll();
+
+		this->TransferInbox();
+
+		b_Executed |= ReadBuffer != nullptr;
+
+		while (ReadBuffer)
+		{
+			Job_T Job(ReadBuffer);
+
+			ReadBuffer = ReadBuffer->NextJob;
+
+			this->ReclaimScratch();
+
+			this->RunJob(Job);
+		}
+
+		Job_T Job;
+
+		while (this->FindJob(Job))
+		{
+			this->ReclaimScratch();
+
+			this->RunJob(Job);
+
+			Job.reset();
+
+			this->ResumeReadyFibers();
+
+			b_Executed = true;
+		}
+
+		return b_Executed;
+	}
+
+	bool FWorkerThread::FindJob(Job_T& Job)
+	{
+		constexpr size_t LevelCount = static_cast<size_t>(EJobPriority::Count);
+
+		// Aging: a level that lost AgingThreshold picks in a row goes first once.
+		for (size_t Level = LevelCount - 1; Level > 0; --Level)
+		{
+			if (StarvedPicks[Level] >= AgingThreshold)
+			{
+				StarvedPicks[Level] = 0;
+
+				if (this->TakeLocal(static_cast<EJobPriority>(Level), Job))
+				{
+					return true;
+				}
+			}
+		}
+
+		for (size_t Level = 0; Level < LevelCount; ++Level)
+		{
+			if (this->TakeLocal(static_cast<EJobPriority>(Level), Job))
+			{
+				StarvedPicks[Level] = 0;
+
+				for (size_t Lower = Level + 1; Lower < LevelCount; ++Lower)
+				{
+					if (this->HasLocal(static_cast<EJobPriority>(Lower)))
+					{
+						++StarvedPicks[Lower];
+					}
+				}
+
+				return true;
+			}
+		}
+
+		if (JobSystem)
+		{
+			return JobSystem->StealJob(this, Job);
+		}
+
+		return false;
+	}
+
+	void FWorkerThread::TransferInbox()
+	{
+		size_t Transferred = 0;
+
+		for (IJob* Job = Inbox.TakeAll(); Job; ++Transferred)
+		{
+			IJob* Next = Job->NextJob;
+
+			Job->NextJob = nullptr;
+
+			LocalJobs.Push(Job);
+
+			Job = Next;
+		}
+
+		InboxCount.fetch_sub(static_cast<uint32_t>(Transferred), std::memory_order_relaxed);
+
+		// More than one stealable job arrived at once, let an idle peer share the load.
+		if (Transferred > 1 && JobSystem)
+		{
+			JobSystem->WakeIdleWorker(this);
+		}
+	}
+
+	void FWorkerThread::SubmitBounded(FJobQueue& Queue, Job_T&& Job)
+	{
+		if (Queue.TrySubmit(Job))
+		{
+			return;
+		}
+
+		// The wake-up for what is already queued may still be pending, e.g. halfway through a batch.
+		if (CurrentWorker != this)
+		{
+			ExecutionLock.Release();
+		}
+
+		FWorkerThread* Current = CurrentWorker && CurrentWorker->JobSystem == JobSystem ? CurrentWorker : nullptr;
+
+		// Jobs run from here may submit to a full queue again, a worker's stack only nests so deep.
+		if (Current && Current->HelpDepth >= MaxHelpDepth)
+		{
+			Current = nullptr;
+		}
+
+		if (QueueFullPolicy == EJobQueueFull::RunInline && (Current || !CurrentWorker))
+		{
+			if (Current)
+			{
+				++Current->HelpDepth;
+
+				Current->RunJob(Job);
+
+				--Current->HelpDepth;
+			}
+			else
+			{
+				FScratchArena::FScope Scope(FScratchArena::GetCurrent());
+
 				Job->Execute();
 			}
 
-			ReadBuffer.clear();
+			return;
+		}
 
-			b_Busy.store(false);
+		// A worker that only waited could end up waiting on consumers that are blocked producing as well.
+		Queue.Submit(std::move(Job), [Current]()
+			{
+				Job_T Other;
+
+				if (!Current || !Current->FindJob(Other))
+				{
+					return false;
+				}
+
+				++Current->HelpDepth;
+
+				Current->RunJob(Other);
+
+				--Current->HelpDepth;
+
+				return true;
+			});
+	}
+
+	void FWorkerThread::SubmitBoundedBatch(FJobQueue& Queue, IJob* const* Jobs, size_t Count)
+	{
+		for (size_t Submitted = Queue.TrySubmitBatch(Jobs, Count); Submitted < Count; ++Submitted)
+		{
+			this->SubmitBounded(Queue, Job_T(Jobs[Submitted]));
 		}
+	}
 
-		StopSemaphore.release();
+	bool FWorkerThread::TakeLocal(EJobPriority Priority, Job_T& Job)
+	{
+		switch (Priority)
+		{
+			case EJobPriority::High:
+			{
+				return HighJobs.TransferFront(Job);
+			}
+
+			case EJobPriority::Background:
+			{
+				return BackgroundJobs.TransferFront(Job);
+			}
+
+			default:
+			{
+				IJob* Local = nullptr;
+
+				if (LocalJobs.Pop(Local))
+				{
+					Job.reset(Local);
+
+					return true;
+				}
+
+				// Outside submissions that arrived during this pass.
+				if (!Inbox.IsEmpty())
+				{
+					this->TransferInbox();
+
+					if (LocalJobs.Pop(Local))
+					{
+						Job.reset(Local);
+
+						return true;
+					}
+				}
+
+				return false;
+			}
+		}
 	}
 
 
 // Private Accessors:
 
-	bool FWorkerThread::BufferIsEmpty(std::vector<Job_T>& Buffer) const
+	bool FWorkerThread::HasPendingJobs() const
+	{
+		return !WriteQueue.IsEmpty() || !Inbox.IsEmpty() || !HighJobs.IsEmpty() || !LocalJobs.IsEmpty() || !BackgroundJobs.IsEmpty()
+			|| ParkedFiberCount > 0 || !ReadyFibers.IsEmpty();
+	}
+
+	size_t FWorkerThread::GetQueuedCount() const
+	{
+		return LocalJobs.Size() + HighJobs.Size() + BackgroundJobs.Size() + InboxCount.load(std::memory_order_relaxed);
+	}
+
+	bool FWorkerThread::HasLocal(EJobPriority Priority) const
 	{
-		std::scoped_lock<std::mutex> Lock(BufferMutex);
+		switch (Priority)
+		{
+			case EJobPriority::High:
+			{
+				return !HighJobs.IsEmpty();
+			}
 
-		return Buffer.empty();
+			case EJobPriority::Background:
+			{
+				return !BackgroundJobs.IsEmpty();
+			}
+
+			default:
+			{
+				return !LocalJobs.IsEmpty() || !Inbox.IsEmpty();
+			}
+		}
 	}
 
 }
\ No newline at end of file
@@ -1,9 +1,15 @@
 #pragma once
 
 #include "TJob.h"
-
+#include "FJobQueue.h"
+#include "TWorkStealingDeque.h"
+#include "TIntrusiveMpscQueue.h"
+#include "FJobTracer.h"
+#include "FFiber.h"
+#include "FScratchArena.h"
+
+#include <cstdint>
 #include <type_traits>
-#include <mutex>
 #include <thread>
 #include <semaphore>
 #include <atomic>
@@ -11,13 +17,32 @@
 
 namespace t3d
 {
+	class FJobSystem;
+
+	using JobQueue_T   = TIntrusiveMpscQueue<IJob, &IJob::NextJob>;
+	using FiberQueue_T = TIntrusiveMpscQueue<FFiber, &FFiber::NextFiber>;
+
+	inline constexpr uint32_t NoWorkerIndex = UINT32_MAX;
+
+	// Index of the worker running on this thread, NoWorkerIndex on any other thread. Set by FWorkerThread::ExecuteJobs.
+	inline thread_local uint32_t CurrentWorkerIndex = NoWorkerIndex;
+
+	// Job system of the worker running on this thread, realtime workers included, null on any other thread.
+	inline thread_local FJobSystem* CurrentWorkerJobSystem = nullptr;
+
+	// Defined in FWorkerThread.cpp. Restricts the calling thread to Core, false if the platform refuses.
+	bool PinThreadToCore(int32_t Core);
+
 	class FWorkerThread
 	{
 	public:
 
+		// Nested helping keeps every waiting job's frame on the stack, deeper waits block instead.
+		static constexpr uint32_t MaxHelpDepth = 16;
+
 	// Constructors and Destructor:
 
-		 FWorkerThread ();		
+		 FWorkerThread (FJobSystem* InJobSystem = nullptr, uint32_t InIndex = 0, int32_t InCore = -1);
 		~FWorkerThread ();
 
 		// No copy
@@ -27,53 +52,126 @@ namespace t3d
 
 		void Launch ();
 		void Stop   ();
-		
+
 		template<typename Functor_T, typename... Args_T>
 		using Return_T = std::invoke_result_t<Functor_T, Args_T...>;
 
+		// Pinned: the job is executed by this worker only.
 		template<typename Functor_T>
-		JobHandle_T<Return_T<Functor_T>> Schedule(Functor_T&& Job)
+		JobHandle_T<Return_T<Functor_T>> Schedule(Functor_T&& Job, const char* Name = nullptr)
 		{
-			TJob<Return_T<Functor_T>> InternalJob(std::move(Job));
+			auto* InternalJob = TJob<Return_T<Functor_T>, std::decay_t<Functor_T>>::Create(JobPool, std::forward<Functor_T>(Job));
 
-			JobHandle_T<Return_T<Functor_T>> Handle = InternalJob.GetHandle();
+			JobHandle_T<Return_T<Functor_T>> Handle = InternalJob->GetHandle();
 
-			{
-				std::scoped_lock<std::mutex> Lock(BufferMutex);
+			InternalJob->Name = Name;
 
-				WriteBuffer.push_back(std::make_unique<TJob<Return_T<Functor_T>>>(std::move(InternalJob)));
+			if (TraceRing)
+			{
+				InternalJob->EnqueueTime = FJobTracer::Now();
 			}
 
+			WriteQueue.Push(InternalJob);
+
 			ExecutionLock.Release();
 
 			return Handle;
 		}
 
+		// Stealable: the job goes to this worker's queue for its priority and may be executed by any worker of the job system.
+		void Submit      (Job_T&& Job, EJobPriority Priority = EJobPriority::Normal);
+		void SubmitBatch (IJob* const* Jobs, size_t Count, EJobPriority Priority = EJobPriority::Normal);
+		bool Steal       (Job_T& Job, EJobPriority Priority);
+		void Wake        ();
+
 	// Accessors:
 
-		bool IsRunning () const;
-		bool IsBusy    () const;
+		bool       IsRunning  () const;
+		bool       IsBusy     () const;
+		uint32_t   GetIndex   () const;
+		int32_t    GetCore    () const;
+		FSlabPool& GetJobPool ();
+
+		static FWorkerThread* GetCurrent ();
 
 	private:
 
 	// Private Functions:
 
-		void ExecuteJobs ();
+		void ExecuteJobs        ();
+		bool TryRetire          ();
+		bool TryPin             ();
+		void Unpin              ();
+		void RunJob             (Job_T& Job);
+		void ExecuteJob         (Job_T& Job);
+		void ReclaimScratch     ();
+		void SwitchToFiber      (FFiber* Fiber);
+		void ResumeFiber        (FFiber* Fiber);
+		bool ResumeReadyFibers  ();
+		void PinToCore          ();
+		bool ExecutePendingJobs ();
+		bool FindJob            (Job_T& Job);
+		void TransferInbox      ();
+		bool TakeLocal          (EJobPriority Priority, Job_T& Job);
+		void SubmitBounded      (FJobQueue& Queue, Job_T&& Job);
+		void SubmitBoundedBatch (FJobQueue& Queue, IJob* const* Jobs, size_t Count);
 
 	// Private Accessors:
 
-		bool BufferIsEmpty (std::vector<Job_T>& Buffer) const;
+		bool   HasPendingJobs () const;
+		bool   HasLocal       (EJobPriority Priority) const;
+		size_t GetQueuedCount () const;
 
 	// Variables:
 
-		mutable std::mutex    BufferMutex;
-		std::vector<Job_T>    WriteBuffer;
-		std::thread           ExecutionThread;
-		FAtomicLock           ExecutionLock;
-		std::binary_semaphore LaunchSemaphore;
-		std::binary_semaphore StopSemaphore;
-		std::atomic<bool>     b_Running;
-		std::atomic<bool>     b_Busy;
+		FJobSystem*                          JobSystem;
+		uint32_t                             Index;
+		int32_t                              Core;
+		FSlabPool                            JobPool;
+		JobQueue_T                           WriteQueue;
+		JobQueue_T                           Inbox;
+		FJobQueue                            HighJobs;
+		TWorkStealingDeque<IJob*>            LocalJobs;
+		FJobQueue                            BackgroundJobs;
+		std::thread                          ExecutionThread;
+		FAtomicLock                          ExecutionLock;
+		std::binary_semaphore                LaunchSemaphore;
+		std::binary_semaphore                StopSemaphore;
+		std::atomic<bool>                    b_Running;
+		std::atomic<bool>                    b_Busy;
+		uint32_t                             VictimSeed;
+		uint32_t                             AgingThreshold;
+		uint32_t                             StarvedPicks[static_cast<size_t>(EJobPriority::Count)];
+		uint32_t                             IdleSpinCount;
+		bool                                 b_HelpWhileWaiting;
+		uint32_t                             HelpDepth;
+		FJobTraceRing*                       TraceRing;
+		uint32_t                             FiberCount;
+		uint32_t                             FiberStackSize;
+		std::vector<std::unique_ptr<FFiber>> Fibers;
+		std::vector<FFiber*>                 FreeFibers;
+		FiberQueue_T                         ReadyFibers;
+		FFiber*                              CurrentFiber;
+		uint32_t                             ParkedFiberCount;
+		EJobQueueFull                        QueueFullPolicy;
+		FScratchArena                        Scratch;
+		bool                                 b_ScratchPerFrame;
+		uint64_t                             ScratchFrame;
+
+		// Elastic pool, see FJobSystem::ScaleWorkers. Workers below FJobSystemConfig::MinWorkerCount never retire.
+		const bool                           b_CanRetire;
+		bool                                 b_Launched;
+		std::atomic<bool>                    b_RetireRequested;
+		std::atomic<bool>                    b_Retiring;
+		std::atomic<uint32_t>                Pins;
+		std::atomic<uint32_t>                InboxCount;
+		std::atomic<int64_t>                 IdleSince;
+
+		friend class FJobSystem;
+		friend class FFiber;
+		friend bool HelpWhileWaiting();
+		friend bool ParkFiberUntilReady(FJobHandleBase& Handle);
+		friend void SubmitContinuation(IJob* Job, FJobSystem* JobSystem);
 	};
 
 //	constexpr size_t Size = sizeof(FWorkerThread);
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "FSlabPool.h"
+
+#include <cstdint>
 #include <memory>
 
 namespace t3d
@@ -16,7 +19,30 @@ namespace t3d
 	// Interface:
 
 		virtual void Execute () = 0;
+
+		// Jobs with a handle skip their functor once cancelled, see FJobHandleBase::Cancel.
+		virtual void Cancel  () {}
+
+	// Variables:
+
+		// Intrusive link for the submission queues.
+		IJob*       NextJob     = nullptr;
+
+		// Shown by FJobTracer. EnqueueTime is only stamped while tracing.
+		const char* Name        = nullptr;
+		int64_t     EnqueueTime = 0;
+	};
+
+	// Jobs live in FSlabPool blocks, see TJob::Create.
+	struct FJobDeleter
+	{
+		void operator () (IJob* Job) const
+		{
+			Job->~IJob();
+
+			FSlabPool::Free(Job);
+		}
 	};
 
-	using Job_T = std::unique_ptr<IJob>;
+	using Job_T = std::unique_ptr<IJob, FJobDeleter>;
 }
\ No newline at end of file
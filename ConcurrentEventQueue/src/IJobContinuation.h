@@ -0,0 +1,30 @@
+#pragma once
+
+#include <coroutine>
+
+namespace t3d
+{
+	// Runs on the thread that signals the handle it was attached to.
+	class IJobContinuation
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		         IJobContinuation () = default;
+		virtual ~IJobContinuation () = default;
+
+	// Interface:
+
+		virtual void Continue () = 0;
+
+		// Set if Continue() does nothing but resume a coroutine. A coroutine that finishes can then transfer to it
+		// instead of resuming it on top of its own stack, see TTaskPromiseBase::FFinalAwaiter.
+		virtual std::coroutine_handle<> GetCoroutine () const { return nullptr; }
+
+	// Variables:
+
+		// Intrusive link for FJobHandleBase's continuation list.
+		IJobContinuation* NextContinuation = nullptr;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+
+namespace t3d
+{
+	// Lock-free multi-producer/single-consumer queue. Nodes carry their own link, so pushing never allocates.
+	// Producers push onto a shared list, the consumer takes the whole list at once, same as swapping a double buffer.
+	template<typename Node_T, Node_T* Node_T::*Next>
+	class TIntrusiveMpscQueue
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		 TIntrusiveMpscQueue () : Head(nullptr) {}
+		~TIntrusiveMpscQueue () = default;
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// Returns true if the queue was empty before the push.
+		bool Push(Node_T* Node)
+		{
+			return this->PushChain(Node, Node);
+		}
+
+		// Newest..Oldest must already be linked through Next, newest first.
+		bool PushChain(Node_T* Newest, Node_T* Oldest)
+		{
+			Node_T* OldHead = Head.load(std::memory_order_relaxed);
+
+			do
+			{
+				Oldest->*Next = OldHead;
+			}
+			while (!Head.compare_exchange_weak(OldHead, Newest, std::memory_order_release, std::memory_order_relaxed));
+
+			return OldHead == nullptr;
+		}
+
+		// Consumer only. Returns the queued nodes in push order, linked through Next.
+		Node_T* TakeAll()
+		{
+			Node_T* Node = Head.exchange(nullptr, std::memory_order_acquire);
+
+			Node_T* Reversed = nullptr;
+
+			while (Node)
+			{
+				Node_T* Following = Node->*Next;
+
+				Node->*Next = Reversed;
+				Reversed    = Node;
+				Node        = Following;
+			}
+
+			return Reversed;
+		}
+
+	// Accessors:
+
+		bool IsEmpty() const
+		{
+			return Head.load(std::memory_order_acquire) == nullptr;
+		}
+
+	private:
+
+	// Variables:
+
+		alignas(64) std::atomic<Node_T*> Head;
+	};
+}
\ No newline at end of file
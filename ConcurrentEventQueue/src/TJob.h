@@ -2,32 +2,77 @@
 
 #include "IJob.h"
 #include "TJobHandle.h"
+#include "FJobCounter.h"
+#include "FSlabPool.h"
 
 #include <memory>
-#include <functional>
+#include <new>
+#include <type_traits>
 
 namespace t3d
 {
-	template<typename Return_T>
+	// Defined in FWorkerThread.cpp. Job pool of the calling worker, null on any other thread.
+	FSlabPool* GetCurrentJobPool();
+
+	// Defined in FWorkerThread.cpp. Queues a continuation job on JobSystem, or on the calling worker's job system if that is null.
+	// Any other thread runs it right away.
+	void SubmitContinuation(IJob* Job, FJobSystem* JobSystem);
+
+	// Functors up to this size are stored inline, so the whole job fits one FSlabPool block.
+	constexpr size_t InlineFunctorSize = 64;
+
+	template<typename Return_T, typename Functor_T>
 	class TJob : public IJob
 	{
 	public:
 
 	// Constructors and Destructor:
 
-		TJob(auto&& Functor)
-			: Functor (std::move(Functor))
-			, Handle  (std::make_shared<TJobHandle<Return_T>>())
+		template<typename Arg_T>
+		TJob(FSlabPool* Pool, Arg_T&& InFunctor)
+			: Functor (std::forward<Arg_T>(InFunctor))
+			, Handle  (MakeJobHandle<Return_T>(Pool))
 		{}
 
+		template<typename Arg_T>
+		static TJob* Create(FSlabPool& Pool, Arg_T&& InFunctor)
+		{
+			static_assert(alignof(Functor_T) <= FSlabPool::BlockAlign, "Over-aligned functors are not supported by FSlabPool!");
+			static_assert(sizeof(Functor_T) > InlineFunctorSize || sizeof(TJob) <= FSlabPool::BlockSize, "Inline functor no longer fits a pool block!");
+
+			return new (Pool.Allocate(sizeof(TJob))) TJob(&Pool, std::forward<Arg_T>(InFunctor));
+		}
+
 	// Functions:
 
 		void Execute() override
 		{
-			Handle->Submit(Functor());
+			if (!Handle->IsCancelled())
+			{
+				const FJobHandleBase* Outer = CurrentJobHandle;
+
+				CurrentJobHandle = Handle.get();
+
+				if constexpr (std::is_void_v<Return_T>)
+				{
+					Functor();
+				}
+				else
+				{
+					Handle->Submit(Functor());
+				}
+
+				CurrentJobHandle = Outer;
+			}
+
 			Handle->Signal();
 		}
 
+		void Cancel() override
+		{
+			Handle->Cancel();
+		}
+
 	// Accessors:
 
 		JobHandle_T<Return_T> GetHandle() const
@@ -37,41 +82,188 @@ namespace t3d
 
 	private:
 
-		std::function<Return_T()> Functor;
-		JobHandle_T<Return_T>     Handle;
+		Functor_T             Functor;
+		JobHandle_T<Return_T> Handle;
 	};
 
-	template<>
-	class TJob<void> : public IJob
+	// No handle to signal, for internal fan-out where completion is tracked elsewhere.
+	template<typename Functor_T>
+	class TDetachedJob : public IJob
 	{
 	public:
 
 	// Constructors and Destructor:
 
-		TJob(auto&& Functor)
-			: Functor (std::move(Functor))
-			, Handle  (std::make_shared<TJobHandle<void>>())
+		template<typename Arg_T>
+		TDetachedJob(Arg_T&& InFunctor)
+			: Functor (std::forward<Arg_T>(InFunctor))
 		{}
 
+		template<typename Arg_T>
+		static TDetachedJob* Create(FSlabPool& Pool, Arg_T&& InFunctor)
+		{
+			static_assert(alignof(Functor_T) <= FSlabPool::BlockAlign, "Over-aligned functors are not supported by FSlabPool!");
+
+			return new (Pool.Allocate(sizeof(TDetachedJob))) TDetachedJob(std::forward<Arg_T>(InFunctor));
+		}
+
 	// Functions:
 
 		void Execute() override
 		{
 			Functor();
+		}
 
-			Handle->Signal();
+	private:
+
+		Functor_T Functor;
+	};
+
+	// Counts its FJobCounter down instead of signaling a handle, see FJobSystem::Schedule(FJobCounter&, ...).
+	template<typename Functor_T>
+	class TCountedJob : public IJob
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		template<typename Arg_T>
+		TCountedJob(FJobCounter& InCounter, Arg_T&& InFunctor)
+			: Functor (std::forward<Arg_T>(InFunctor))
+			, Counter (InCounter)
+		{}
+
+		template<typename Arg_T>
+		static TCountedJob* Create(FSlabPool& Pool, FJobCounter& InCounter, Arg_T&& InFunctor)
+		{
+			static_assert(alignof(Functor_T) <= FSlabPool::BlockAlign, "Over-aligned functors are not supported by FSlabPool!");
+
+			return new (Pool.Allocate(sizeof(TCountedJob))) TCountedJob(InCounter, std::forward<Arg_T>(InFunctor));
 		}
 
-	// Accessors:
+	// Functions:
 
-		JobHandle_T<void> GetHandle() const
+		void Execute() override
 		{
-			return Handle;
+			Functor();
+
+			Counter.Decrement();
 		}
 
 	private:
 
-		std::function<void()> Functor;
-		JobHandle_T<void>     Handle;
+		Functor_T    Functor;
+		FJobCounter& Counter;
 	};
+
+	// Job that is held back on another handle and submitted once that one signals, see TJobHandle::Then.
+	template<typename Return_T, typename Functor_T>
+	class TContinuationJob : public TJob<Return_T, Functor_T>, public IJobContinuation
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		template<typename Arg_T>
+		TContinuationJob(FSlabPool* Pool, FJobSystem* InJobSystem, const FJobHandleBase* InSource, Arg_T&& InFunctor)
+			: TJob<Return_T, Functor_T> (Pool, std::forward<Arg_T>(InFunctor))
+			, JobSystem                 (InJobSystem)
+			, Source                    (InSource)
+		{}
+
+		// Pool may be null, the job then lives on the heap. So may JobSystem, see SubmitContinuation.
+		template<typename Arg_T>
+		static TContinuationJob* Create(FSlabPool* Pool, FJobSystem* InJobSystem, const FJobHandleBase* InSource, Arg_T&& InFunctor)
+		{
+			static_assert(alignof(Functor_T) <= FSlabPool::BlockAlign, "Over-aligned functors are not supported by FSlabPool!");
+
+			void* Memory = Pool ? Pool->Allocate(sizeof(TContinuationJob)) : FSlabPool::AllocateUnpooled(sizeof(TContinuationJob));
+
+			return new (Memory) TContinuationJob(Pool, InJobSystem, InSource, std::forward<Arg_T>(InFunctor));
+		}
+
+	// Functions:
+
+		// Registers with the source handle, or submits right away if it has signaled already.
+		void Attach(FJobHandleBase& InSource)
+		{
+			if (!InSource.AddContinuation(this))
+			{
+				this->Continue();
+			}
+		}
+
+		void Continue() override
+		{
+			// A cancelled source has no result to hand over, the continuation only signals.
+			if (Source->IsCancelled())
+			{
+				this->Cancel();
+			}
+
+			SubmitContinuation(this, JobSystem);
+		}
+
+	private:
+
+		FJobSystem*           JobSystem;
+		const FJobHandleBase* Source;
+	};
+
+	template<typename Return_T>
+	template<typename Functor_T>
+	JobHandle_T<std::invoke_result_t<Functor_T, Return_T&&>> TJobHandle<Return_T>::Then(Functor_T&& Functor)
+	{
+		return this->ThenOn(nullptr, std::forward<Functor_T>(Functor));
+	}
+
+	template<typename Return_T>
+	template<typename Functor_T>
+	JobHandle_T<std::invoke_result_t<Functor_T, Return_T&&>> TJobHandle<Return_T>::Then(FJobSystem& JobSystem, Functor_T&& Functor)
+	{
+		return this->ThenOn(&JobSystem, std::forward<Functor_T>(Functor));
+	}
+
+	template<typename Return_T>
+	template<typename Functor_T>
+	JobHandle_T<std::invoke_result_t<Functor_T, Return_T&&>> TJobHandle<Return_T>::ThenOn(FJobSystem* JobSystem, Functor_T&& Functor)
+	{
+		// The job keeps this handle alive until it has taken the result.
+		auto Next = [Source = JobHandle_T<Return_T>(this), Functor = std::forward<Functor_T>(Functor)]() mutable
+			{
+				return Functor(Source->TakeResult());
+			};
+
+		auto* Job = TContinuationJob<std::invoke_result_t<Functor_T, Return_T&&>, decltype(Next)>::Create(GetCurrentJobPool(), JobSystem, this, std::move(Next));
+
+		auto Handle = Job->GetHandle();
+
+		Job->Attach(*this);
+
+		return Handle;
+	}
+
+	template<typename Functor_T>
+	JobHandle_T<std::invoke_result_t<Functor_T>> TJobHandle<void>::Then(Functor_T&& Functor)
+	{
+		return this->ThenOn(nullptr, std::forward<Functor_T>(Functor));
+	}
+
+	template<typename Functor_T>
+	JobHandle_T<std::invoke_result_t<Functor_T>> TJobHandle<void>::Then(FJobSystem& JobSystem, Functor_T&& Functor)
+	{
+		return this->ThenOn(&JobSystem, std::forward<Functor_T>(Functor));
+	}
+
+	template<typename Functor_T>
+	JobHandle_T<std::invoke_result_t<Functor_T>> TJobHandle<void>::ThenOn(FJobSystem* JobSystem, Functor_T&& Functor)
+	{
+		auto* Job = TContinuationJob<std::invoke_result_t<Functor_T>, std::decay_t<Functor_T>>::Create(GetCurrentJobPool(), JobSystem, this, std::forward<Functor_T>(Functor));
+
+		auto Handle = Job->GetHandle();
+
+		Job->Attach(*this);
+
+		return Handle;
+	}
 }
\ No newline at end of file
@@ -1,20 +1,327 @@
 #pragma once
 
 #include "FAtomicLock.h"
+#include "FSlabPool.h"
+#include "IJobContinuation.h"
 
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace t3d
 {
+	class FJobHandleBase;
+	class FJobSystem;
+
+	// Defined in FWorkerThread.cpp. Runs one queued job if the calling thread is a worker that helps while waiting.
+	bool HelpWhileWaiting();
+
+	// Defined in FWorkerThread.cpp. Parks the calling job until Handle signals if it runs on a fiber.
+	bool ParkFiberUntilReady(FJobHandleBase& Handle);
+
+	// Handle of the job running on this thread, set by TJob::Execute.
+	inline thread_local const FJobHandleBase* CurrentJobHandle = nullptr;
+
+	class FJobHandleBase
+	{
+	public:
+
+	// Constructors and Destructors:
+
+		 FJobHandleBase () : Continuations(nullptr), b_Cancelled(false), ReferenceCount(0) {}
+		~FJobHandleBase () = default;
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// Returns false if the handle is already signaled, the caller has to run the continuation itself then.
+		bool AddContinuation(IJobContinuation* Continuation)
+		{
+			IJobContinuation* Head = Continuations.load(std::memory_order_acquire);
+
+			do
+			{
+				if (IsCompleted(Head))
+				{
+					return false;
+				}
+
+				Continuation->NextContinuation = Head;
+			}
+			while (!Continuations.compare_exchange_weak(Head, Continuation, std::memory_order_release, std::memory_order_acquire));
+
+			return true;
+		}
+
+		void Signal()
+		{
+			IJobContinuation* Continuation = this->Complete();
+
+			// A continuation may free itself, so read the link before running it.
+			while (Continuation)
+			{
+				IJobContinuation* Next = Continuation->NextContinuation;
+
+				Continuation->Continue();
+
+				Continuation = Next;
+			}
+		}
+
+		// Signals without running the continuations, the caller has to run every one of them. Oldest first.
+		IJobContinuation* Complete()
+		{
+			// Settles whether the job counts as cancelled, a Cancel() that loses the race to this has no effect on dependents.
+			IJobContinuation* Head = Continuations.exchange(Completed(b_Cancelled.load(std::memory_order_acquire)), std::memory_order_acq_rel);
+
+			AwaitLock.Release();
+
+			IJobContinuation* Reversed = nullptr;
+
+			while (Head)
+			{
+				IJobContinuation* Next = Head->NextContinuation;
+
+				Head->NextContinuation = Reversed;
+				Reversed               = Head;
+				Head                   = Next;
+			}
+
+			return Reversed;
+		}
+
+		void Wait()
+		{
+			if (this->IsReady())
+			{
+				return;
+			}
+
+			// Other jobs run on this thread while the fiber is parked.
+			const FJobHandleBase* Waiting = CurrentJobHandle;
+
+			if (ParkFiberUntilReady(*this))
+			{
+				CurrentJobHandle = Waiting;
+
+				return;
+			}
+
+			while (!this->IsReady())
+			{
+				if (HelpWhileWaiting())
+				{
+					continue;
+				}
+
+				AwaitLock.Acquire();
+
+				// Pass the wake-up on to the next waiter.
+				AwaitLock.Release();
+			}
+		}
+
+		// A job that hasn't started yet is skipped, one that is running can poll IsJobCancelled() and bail out.
+		// Either way the handle signals as usual, so continuations and dependent jobs are not left hanging.
+		// Returns false if the job had already finished, nothing changes then. A job finishing at the same time may
+		// still count as done rather than cancelled.
+		bool Cancel()
+		{
+			if (this->IsReady())
+			{
+				return false;
+			}
+
+			b_Cancelled.store(true, std::memory_order_release);
+
+			return true;
+		}
+
+		// Fails the handle instead of giving it a result, Await and TakeResult rethrow the exception. Set it before signaling.
+		void SetException(std::exception_ptr InException)
+		{
+			Exception = std::move(InException);
+		}
+
+	// Accessors:
+
+		bool IsReady() const
+		{
+			return IsCompleted(Continuations.load(std::memory_order_acquire));
+		}
+
+		// Once the handle has signaled, whether the job was cancelled by then. Before that, whether Cancel() was called.
+		bool IsCancelled() const
+		{
+			IJobContinuation* Head = Continuations.load(std::memory_order_acquire);
+
+			return IsCompleted(Head) ? Head == Completed(true) : b_Cancelled.load(std::memory_order_acquire);
+		}
+
+	protected:
+
+	// Protected Functions:
+
+		void RethrowException() const
+		{
+			if (Exception)
+			{
+				std::rethrow_exception(Exception);
+			}
+		}
+
+		void AddReference()
+		{
+			ReferenceCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// True for the last reference, which destroys the handle.
+		bool ReleaseReference()
+		{
+			return ReferenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+		}
+
+	private:
+
+	// Private Functions:
+
+		// Tags in place of the list, continuations are aligned so the low bit is free.
+		static IJobContinuation* Completed(bool b_WasCancelled)
+		{
+			return reinterpret_cast<IJobContinuation*>(b_WasCancelled ? uintptr_t(3) : uintptr_t(1));
+		}
+
+		static bool IsCompleted(IJobContinuation* Head)
+		{
+			return (reinterpret_cast<uintptr_t>(Head) & 1) != 0;
+		}
+
+	// Variables:
+
+		std::atomic<IJobContinuation*> Continuations;
+		FAtomicLock                    AwaitLock;
+		std::atomic<bool>              b_Cancelled;
+		std::atomic<uint32_t>          ReferenceCount;
+		std::exception_ptr             Exception;
+
+		template<typename Handle_T>
+		friend class TJobHandlePtr;
+	};
+
+	// Owning handle reference, shaped like the parts of std::shared_ptr callers use. The count lives in the handle itself,
+	// so there is no control block, and the last reference hands the handle's block back to the FSlabPool it came from.
+	template<typename Handle_T>
+	class TJobHandlePtr
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		TJobHandlePtr(std::nullptr_t = nullptr) noexcept
+			: Handle (nullptr)
+		{}
+
+		// Adopts a handle placed in FSlabPool memory, see MakeJobHandle.
+		explicit TJobHandlePtr(Handle_T* InHandle) noexcept
+			: Handle (InHandle)
+		{
+			if (Handle)
+			{
+				Handle->AddReference();
+			}
+		}
+
+		TJobHandlePtr(const TJobHandlePtr& Other) noexcept
+			: TJobHandlePtr (Other.Handle)
+		{}
+
+		TJobHandlePtr(TJobHandlePtr&& Other) noexcept
+			: Handle (std::exchange(Other.Handle, nullptr))
+		{}
+
+		~TJobHandlePtr()
+		{
+			this->reset();
+		}
+
+		TJobHandlePtr& operator = (TJobHandlePtr Other) noexcept
+		{
+			std::swap(Handle, Other.Handle);
+
+			return *this;
+		}
+
+	// Functions:
+
+		void reset()
+		{
+			Handle_T* Released = std::exchange(Handle, nullptr);
+
+			if (Released && Released->ReleaseReference())
+			{
+				Released->~Handle_T();
+
+				FSlabPool::Free(Released);
+			}
+		}
+
+	// Accessors:
+
+		Handle_T* get() const
+		{
+			return Handle;
+		}
+
+		Handle_T* operator -> () const
+		{
+			return Handle;
+		}
+
+		Handle_T& operator * () const
+		{
+			return *Handle;
+		}
+
+		explicit operator bool () const
+		{
+			return Handle != nullptr;
+		}
+
+		bool operator == (const TJobHandlePtr& Other) const = default;
+
+	private:
+
+	// Variables:
+
+		Handle_T* Handle;
+	};
+
+	// The result of a cancelled job was asked for, but the job never got to produce it.
+	class FJobCancelledError : public std::runtime_error
+	{
+	public:
+
+		FJobCancelledError() : std::runtime_error("Job was cancelled before it produced a result") {}
+	};
+
 	template<typename Return_T>
-	class TJobHandle
+	class TJobHandle : public FJobHandleBase
 	{
 	public:
 
 	// Constructors and Destructors:
 
 		TJobHandle()
-			: Result (nullptr)
+			: b_HasResult (false)
 		{}
 
 		~TJobHandle()
@@ -28,43 +335,78 @@ namespace t3d
 		{
 			this->TryDelete();
 
-			Result = new Return_T(std::forward<Return_T>(Value));
+			new (Storage) Return_T(std::forward<Return_T>(Value));
+
+			b_HasResult = true;
 		}
 
-		void Signal()
+		// Throws FJobCancelledError if the job was cancelled before it produced a result, or the exception it failed with.
+		Return_T Await()
 		{
-			AwaitLock.Release();
+			this->Wait();
+
+			this->RethrowException();
+
+			if (!b_HasResult)
+			{
+				throw FJobCancelledError();
+			}
+
+			return *std::launder(reinterpret_cast<Return_T*>(Storage));
 		}
 
-		Return_T Await()
+		// Moves the result out instead of copying it, for the one consumer of the handle. Throws like Await.
+		Return_T TakeResult()
 		{
-			AwaitLock.Acquire();
+			this->Wait();
+
+			this->RethrowException();
+
+			if (!b_HasResult)
+			{
+				throw FJobCancelledError();
+			}
 
-			return *Result;
+			return std::move(*std::launder(reinterpret_cast<Return_T*>(Storage)));
 		}
 
+		// Schedules Functor(Return_T&&) as a job of its own once this handle signals, with the result moved in.
+		// Nothing blocks. A continuation attached after the fact is scheduled right away. It goes to the job system
+		// of the thread that signals or attaches, and runs right there if that isn't a worker, see SubmitContinuation.
+		// Defined in TJob.h.
+		template<typename Functor_T>
+		TJobHandlePtr<TJobHandle<std::invoke_result_t<Functor_T, Return_T&&>>> Then(Functor_T&& Functor);
+
+		// Same, but always scheduled on JobSystem, whichever thread signals or attaches.
+		template<typename Functor_T>
+		TJobHandlePtr<TJobHandle<std::invoke_result_t<Functor_T, Return_T&&>>> Then(FJobSystem& JobSystem, Functor_T&& Functor);
+
 	private:
 
 	// Private Functions:
 
+		template<typename Functor_T>
+		TJobHandlePtr<TJobHandle<std::invoke_result_t<Functor_T, Return_T&&>>> ThenOn(FJobSystem* JobSystem, Functor_T&& Functor);
+
 		void TryDelete()
 		{
-			if (Result)
+			if (b_HasResult)
 			{
-				delete Result;
+				std::launder(reinterpret_cast<Return_T*>(Storage))->~Return_T();
 
-				Result = nullptr;
+				b_HasResult = false;
 			}
 		}
 
 	// Variables:
 
-		FAtomicLock AwaitLock;
-		Return_T*   Result;
+		// Result lives inline, no allocation per job.
+		alignas(Return_T) std::byte Storage[sizeof(Return_T)];
+		bool                        b_HasResult;
 	};
 
 	template<>
-	class TJobHandle<void>
+	class TJobHandle<void> : public FJobHandleBase
 	{
 	public:
 
@@ -75,23 +417,52 @@ namespace t3d
 
 	// Functions:
 
-		void Signal()
-		{
-			AwaitLock.Release();
-		}
-
+		// Throws the exception the job failed with, if any.
 		void Await()
 		{
-			AwaitLock.Acquire();
+			this->Wait();
+
+			this->RethrowException();
 		}
 
+		// Schedules Functor() as a job of its own once this handle signals, see TJobHandle::Then. Defined in TJob.h.
+		template<typename Functor_T>
+		TJobHandlePtr<TJobHandle<std::invoke_result_t<Functor_T>>> Then(Functor_T&& Functor);
+
+		template<typename Functor_T>
+		TJobHandlePtr<TJobHandle<std::invoke_result_t<Functor_T>>> Then(FJobSystem& JobSystem, Functor_T&& Functor);
+
 	private:
 
-	// Variables:
+	// Private Functions:
 
-		FAtomicLock AwaitLock;
+		template<typename Functor_T>
+		TJobHandlePtr<TJobHandle<std::invoke_result_t<Functor_T>>> ThenOn(FJobSystem* JobSystem, Functor_T&& Functor);
 	};
 
+	// Inside a job: true once its handle has been cancelled. Long jobs poll it to drop stale work early.
+	inline bool IsJobCancelled()
+	{
+		return CurrentJobHandle && CurrentJobHandle->IsCancelled();
+	}
+
+	template<typename Return_T>
+	using JobHandle_T = TJobHandlePtr<TJobHandle<Return_T>>;
+
+	// Handles of pooled jobs recycle their block through the pool's free list, handles without a pool go to the heap.
+	template<typename Return_T>
+	JobHandle_T<Return_T> MakeJobHandle(FSlabPool* Pool = nullptr)
+	{
+		static_assert(alignof(TJobHandle<Return_T>) <= FSlabPool::BlockAlign, "Over-aligned results are not supported by FSlabPool!");
+
+		void* Memory = Pool ? Pool->Allocate(sizeof(TJobHandle<Return_T>)) : FSlabPool::AllocateUnpooled(sizeof(TJobHandle<Return_T>));
+
+		return JobHandle_T<Return_T>(new (Memory) TJobHandle<Return_T>());
+	}
+
+	template<typename T>
+	constexpr bool IsJobHandle_V = false;
+
 	template<typename Return_T>
-	using JobHandle_T = std::shared_ptr<TJobHandle<Return_T>>;
+	constexpr bool IsJobHandle_V<JobHandle_T<Return_T>> = true;
 }
\ No newline at end of file
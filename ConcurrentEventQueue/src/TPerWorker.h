@@ -0,0 +1,166 @@
+#pragma once
+
+#include "FJobSystem.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace t3d
+{
+	// One T per worker of a job system, realtime workers included, each on its own cache line, so jobs can accumulate counters
+	// or histograms without sharing a line. Local() picks the calling worker's slot. Threads that aren't workers of this job
+	// system, workers of another one included, share one extra slot: it belongs to the first of them to call Local() until
+	// ReleaseExtraSlot() or Reset(), debug builds assert if another one uses it meanwhile. Combine() and ForEach() read every
+	// slot, only call them once the jobs writing to it are done.
+	template<typename T>
+	class TPerWorker
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		explicit TPerWorker(const FJobSystem& JobSystem, const T& Initial = T())
+			: Owner     (&JobSystem)
+			, SlotCount (JobSystem.GetWorkerCount() + JobSystem.GetRealtimeWorkerCount() + 1)
+			, Slots     (std::make_unique<FSlot[]>(SlotCount))
+		{
+			this->Reset(Initial);
+		}
+
+		~TPerWorker() = default;
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		T& Local()
+		{
+			// Worker indices only mean something within their own job system.
+			if (CurrentWorkerJobSystem != Owner)
+			{
+				this->ClaimExtraSlot();
+
+				return Slots[SlotCount - 1].Value;
+			}
+
+			const uint32_t WorkerIndex = CurrentWorkerIndex;
+
+			assert(WorkerIndex < SlotCount - 1 && "Worker index out of range!");
+
+			return Slots[WorkerIndex].Value;
+		}
+
+		template<typename Functor_T>
+		void ForEach(Functor_T&& Functor)
+		{
+			for (size_t Slot = 0; Slot < SlotCount; ++Slot)
+			{
+				Functor(Slots[Slot].Value);
+			}
+		}
+
+		template<typename Functor_T>
+		void ForEach(Functor_T&& Functor) const
+		{
+			for (size_t Slot = 0; Slot < SlotCount; ++Slot)
+			{
+				Functor(Slots[Slot].Value);
+			}
+		}
+
+		// Folds the slots in worker order with Reduce(T, T), the extra slot comes last.
+		template<typename Reduce_T = std::plus<>>
+		T Combine(Reduce_T&& Reduce = Reduce_T()) const
+		{
+			T Result = Slots[0].Value;
+
+			for (size_t Slot = 1; Slot < SlotCount; ++Slot)
+			{
+				Result = Reduce(std::move(Result), Slots[Slot].Value);
+			}
+
+			return Result;
+		}
+
+		void Reset(const T& Value = T())
+		{
+			for (size_t Slot = 0; Slot < SlotCount; ++Slot)
+			{
+				Slots[Slot].Value = Value;
+			}
+
+			this->ReleaseExtraSlot();
+		}
+
+		// The next thread outside the job system to call Local() takes the extra slot over.
+		// Only call it once the current one is done with the slot.
+		void ReleaseExtraSlot()
+		{
+#if !defined NDEBUG
+			ExtraSlotOwner.store(std::thread::id(), std::memory_order_relaxed);
+#endif
+		}
+
+	// Accessors:
+
+		size_t GetSlotCount() const
+		{
+			return SlotCount;
+		}
+
+		T& operator[](size_t Slot)
+		{
+			assert(Slot < SlotCount && "Slot out of range!");
+
+			return Slots[Slot].Value;
+		}
+
+		const T& operator[](size_t Slot) const
+		{
+			assert(Slot < SlotCount && "Slot out of range!");
+
+			return Slots[Slot].Value;
+		}
+
+	private:
+
+		struct alignas(64) FSlot
+		{
+			T Value;
+		};
+
+	// Private Functions:
+
+		// Jobs run inline or while helping also land on outside threads, two of those at once would race on the extra slot.
+		void ClaimExtraSlot()
+		{
+#if !defined NDEBUG
+			const std::thread::id Self     = std::this_thread::get_id();
+			std::thread::id       Previous = std::thread::id();
+
+			const bool b_Claimed = ExtraSlotOwner.compare_exchange_strong(Previous, Self, std::memory_order_relaxed) || Previous == Self;
+
+			assert(b_Claimed && "Another thread outside the job system is using the extra slot!");
+#endif
+		}
+
+	// Variables:
+
+		const FJobSystem*        Owner;
+		const size_t             SlotCount;
+		std::unique_ptr<FSlot[]> Slots;
+
+#if !defined NDEBUG
+		std::atomic<std::thread::id> ExtraSlotOwner;
+#endif
+	};
+
+//	constexpr size_t Size = sizeof(TPerWorker<uint64_t>);
+}
\ No newline at end of file
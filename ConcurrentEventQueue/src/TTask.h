@@ -0,0 +1,245 @@
+#pragma once
+
+#include "TJobHandle.h"
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace t3d
+{
+	// Suspends the coroutine until the handle signals. It resumes on the thread that signals the handle,
+	// normally the worker that just finished the job, so the result is still in that core's cache.
+	template<typename Return_T>
+	class TJobHandleAwaiter : public IJobContinuation
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		explicit TJobHandleAwaiter(JobHandle_T<Return_T> InHandle)
+			: Handle (std::move(InHandle))
+		{}
+
+	// Functions:
+
+		bool await_ready() const
+		{
+			return Handle->IsReady();
+		}
+
+		bool await_suspend(std::coroutine_handle<> InCoroutine)
+		{
+			Coroutine = InCoroutine;
+
+			// Signaled in the meantime, keep going on this thread.
+			return Handle->AddContinuation(this);
+		}
+
+		Return_T await_resume()
+		{
+			return Handle->Await();
+		}
+
+		void Continue() override
+		{
+			// The awaiter lives in the coroutine frame, which may be gone once resume() returns.
+			Coroutine.resume();
+		}
+
+		std::coroutine_handle<> GetCoroutine() const override
+		{
+			return Coroutine;
+		}
+
+	protected:
+
+	// Variables:
+
+		JobHandle_T<Return_T>   Handle;
+		std::coroutine_handle<> Coroutine;
+	};
+
+	template<typename Return_T>
+	TJobHandleAwaiter<Return_T> operator co_await (const JobHandle_T<Return_T>& Handle)
+	{
+		return TJobHandleAwaiter<Return_T>(Handle);
+	}
+
+	// A task has one consumer, so its result is moved out, which also lets tasks return move-only types.
+	template<typename Return_T>
+	class TTaskAwaiter : public TJobHandleAwaiter<Return_T>
+	{
+	public:
+
+	// Constructors and Destructor:
+
+		using TJobHandleAwaiter<Return_T>::TJobHandleAwaiter;
+
+	// Functions:
+
+		Return_T await_resume()
+		{
+			if constexpr (std::is_void_v<Return_T>)
+			{
+				this->Handle->Await();
+			}
+			else
+			{
+				return this->Handle->TakeResult();
+			}
+		}
+	};
+
+	template<typename Return_T>
+	class TTask;
+
+	template<typename Return_T>
+	class TTaskPromiseBase
+	{
+	public:
+
+		// Signals the task handle once the coroutine is done and destroys the frame. A coroutine awaiting the task resumes
+		// in its place rather than on top of it (symmetric transfer), so a long chain of co_awaits runs in constant stack.
+		class FFinalAwaiter
+		{
+		public:
+
+			bool await_ready() noexcept
+			{
+				return false;
+			}
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> Self) noexcept
+			{
+				std::coroutine_handle<> Next = nullptr;
+
+				IJobContinuation* Continuation = Handle->Complete();
+
+				// The first awaiting coroutine goes last, by transfer. Everything else runs here as Signal() would.
+				while (Continuation)
+				{
+					IJobContinuation* Following = Continuation->NextContinuation;
+
+					if (!Next && Continuation->GetCoroutine())
+					{
+						Next = Continuation->GetCoroutine();
+					}
+					else
+					{
+						Continuation->Continue();
+					}
+
+					Continuation = Following;
+				}
+
+				// The awaiter lives in the frame, nothing of it may be touched from here on.
+				Self.destroy();
+
+				return Next ? Next : std::noop_coroutine();
+			}
+
+			void await_resume() noexcept {}
+
+			TJobHandle<Return_T>* Handle;
+		};
+
+	// Functions:
+
+		TTask<Return_T> get_return_object()
+		{
+			return TTask<Return_T>(Handle);
+		}
+
+		// Eager: runs on the calling thread up to the first suspension.
+		std::suspend_never initial_suspend() noexcept
+		{
+			return {};
+		}
+
+		FFinalAwaiter final_suspend() noexcept
+		{
+			return FFinalAwaiter{ Handle.get() };
+		}
+
+		// The frame is gone once the task signals, so the exception waits on the handle. Await, TakeResult
+		// and co_await on the task rethrow it.
+		void unhandled_exception()
+		{
+			Handle->SetException(std::current_exception());
+		}
+
+	protected:
+
+	// Variables:
+
+		JobHandle_T<Return_T> Handle = MakeJobHandle<Return_T>();
+	};
+
+	template<typename Return_T>
+	class TTaskPromise : public TTaskPromiseBase<Return_T>
+	{
+	public:
+
+		void return_value(Return_T Value)
+		{
+			this->Handle->Submit(std::move(Value));
+		}
+	};
+
+	template<>
+	class TTaskPromise<void> : public TTaskPromiseBase<void>
+	{
+	public:
+
+		void return_void() {}
+	};
+
+	// Coroutine return type. The task only shares the result handle with its coroutine, so it may be dropped at any time.
+	template<typename Return_T>
+	class TTask
+	{
+	public:
+
+		using promise_type = TTaskPromise<Return_T>;
+
+	// Constructors and Destructor:
+
+		explicit TTask(JobHandle_T<Return_T> InHandle)
+			: Handle (std::move(InHandle))
+		{}
+
+	// Functions:
+
+		// Blocking, for callers that are not coroutines themselves.
+		Return_T Await() const
+		{
+			return Handle->Await();
+		}
+
+		TTaskAwaiter<Return_T> operator co_await () const
+		{
+			return TTaskAwaiter<Return_T>(Handle);
+		}
+
+	// Accessors:
+
+		bool IsReady() const
+		{
+			return Handle->IsReady();
+		}
+
+		const JobHandle_T<Return_T>& GetHandle() const
+		{
+			return Handle;
+		}
+
+	private:
+
+	// Variables:
+
+		JobHandle_T<Return_T> Handle;
+	};
+}
\ No newline at end of file
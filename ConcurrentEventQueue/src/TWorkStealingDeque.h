@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <type_traits>
+#include <cstdint>
+
+namespace t3d
+{
+	// Chase-Lev deque: the owner thread pushes and pops at the bottom, any other thread steals from the top.
+	template<typename T>
+	class TWorkStealingDeque
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "TWorkStealingDeque stores items in atomics!");
+
+	public:
+
+	// Constructors and Destructor:
+
+		explicit TWorkStealingDeque(int64_t Capacity = 1024)
+			: Top    (0)
+			, Bottom (0)
+			, Buffer (new FRingBuffer(Capacity))
+		{}
+
+		~TWorkStealingDeque()
+		{
+			delete Buffer.load(std::memory_order_relaxed);
+		}
+
+		// No copy
+		// No move
+
+	// Functions:
+
+		// Owner only.
+		void Push(T Item)
+		{
+			const int64_t BottomIndex = Bottom.load(std::memory_order_relaxed);
+			const int64_t TopIndex    = Top.load(std::memory_order_acquire);
+
+			FRingBuffer* Ring = Buffer.load(std::memory_order_relaxed);
+
+			if (BottomIndex - TopIndex > Ring->Capacity - 1)
+			{
+				Ring = this->Grow(Ring, BottomIndex, TopIndex);
+			}
+
+			Ring->Put(BottomIndex, Item);
+
+			// Publishes the item to thieves.
+			Bottom.store(BottomIndex + 1, std::memory_order_release);
+		}
+
+		// Owner only.
+		bool Pop(T& Item)
+		{
+			const int64_t BottomIndex = Bottom.load(std::memory_order_relaxed) - 1;
+
+			FRingBuffer* Ring = Buffer.load(std::memory_order_relaxed);
+
+			Bottom.store(BottomIndex, std::memory_order_relaxed);
+
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			int64_t TopIndex = Top.load(std::memory_order_relaxed);
+
+			if (TopIndex > BottomIndex)
+			{
+				Bottom.store(BottomIndex + 1, std::memory_order_relaxed);
+
+				return false;
+			}
+
+			Item = Ring->Get(BottomIndex);
+
+			if (TopIndex == BottomIndex)
+			{
+				// Last item, race against thieves for it.
+				const bool b_Won = Top.compare_exchange_strong(TopIndex, TopIndex + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+				Bottom.store(BottomIndex + 1, std::memory_order_relaxed);
+
+				return b_Won;
+			}
+
+			return true;
+		}
+
+		// Any thread.
+		bool Steal(T& Item)
+		{
+			int64_t TopIndex = Top.load(std::memory_order_acquire);
+
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			const int64_t BottomIndex = Bottom.load(std::memory_order_acquire);
+
+			if (TopIndex >= BottomIndex)
+			{
+				return false;
+			}
+
+			FRingBuffer* Ring = Buffer.load(std::memory_order_acquire);
+
+			Item = Ring->Get(TopIndex);
+
+			return Top.compare_exchange_strong(TopIndex, TopIndex + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+
+	// Accessors:
+
+		bool IsEmpty() const
+		{
+			return this->Size() == 0;
+		}
+
+		size_t Size() const
+		{
+			const int64_t BottomIndex = Bottom.load(std::memory_order_relaxed);
+			const int64_t TopIndex    = Top.load(std::memory_order_relaxed);
+
+			return BottomIndex > TopIndex ? static_cast<size_t>(BottomIndex - TopIndex) : 0;
+		}
+
+	private:
+
+		class FRingBuffer
+		{
+		public:
+
+			explicit FRingBuffer(int64_t InCapacity)
+				: Capacity (InCapacity)
+				, Mask     (InCapacity - 1)
+				, Items    (new std::atomic<T>[static_cast<size_t>(InCapacity)])
+			{}
+
+			T Get(int64_t Index) const
+			{
+				return Items[Index & Mask].load(std::memory_order_relaxed);
+			}
+
+			void Put(int64_t Index, T Item)
+			{
+				Items[Index & Mask].store(Item, std::memory_order_relaxed);
+			}
+
+			const int64_t                    Capacity;
+			const int64_t                    Mask;
+			std::unique_ptr<std::atomic<T>[]> Items;
+		};
+
+	// Private Functions:
+
+		FRingBuffer* Grow(FRingBuffer* Ring, int64_t BottomIndex, int64_t TopIndex)
+		{
+			FRingBuffer* NewRing = new FRingBuffer(Ring->Capacity * 2);
+
+			for (int64_t Index = TopIndex; Index < BottomIndex; ++Index)
+			{
+				NewRing->Put(Index, Ring->Get(Index));
+			}
+
+			// Thieves may still read from the old ring, keep it until the deque dies.
+			RetiredBuffers.emplace_back(Ring);
+
+			Buffer.store(NewRing, std::memory_order_release);
+
+			return NewRing;
+		}
+
+	// Variables:
+
+		alignas(64) std::atomic<int64_t>          Top;
+		alignas(64) std::atomic<int64_t>          Bottom;
+		alignas(64) std::atomic<FRingBuffer*>     Buffer;
+		std::vector<std::unique_ptr<FRingBuffer>> RetiredBuffers;
+	};
+}
\ No newline at end of file
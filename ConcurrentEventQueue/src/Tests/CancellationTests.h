@@ -0,0 +1,155 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+#include "../TTask.h"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace t3d::test
+{
+	// A cancelled prerequisite cancels the jobs behind it, all the way down, and none of them runs.
+	inline bool TestCancelledPrerequisitePropagates()
+	{
+		bool b_Passed = true;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 2;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		std::atomic<uint32_t> RunCount = 0;
+
+		JobHandle_T<void> Prerequisite = MakeJobHandle<void>();
+
+		JobHandle_T<int32_t> Middle = JobSystem.Schedule([&RunCount]() { RunCount.fetch_add(1); return 1; }, Prerequisite);
+		JobHandle_T<void>    Last   = JobSystem.Schedule([&RunCount]() { RunCount.fetch_add(1); }, Middle);
+
+		b_Passed &= Expect(Prerequisite->Cancel(), "Pending handle refused to cancel");
+
+		Prerequisite->Signal();
+
+		Last->Wait();
+
+		b_Passed &= Expect(Middle->IsCancelled() && Last->IsCancelled(), "Cancellation didn't pass through the gates");
+		b_Passed &= Expect(RunCount.load() == 0,                         "A job behind a cancelled prerequisite ran");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	// Cancelling a finished job changes nothing, its dependents and continuations still get the result.
+	inline bool TestCancelAfterFinish()
+	{
+		bool b_Passed = true;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 2;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		JobHandle_T<int32_t> Done = JobSystem.Schedule([]() { return 5; });
+
+		Done->Wait();
+
+		b_Passed &= Expect(!Done->Cancel(),      "Cancel reported success on a finished job");
+		b_Passed &= Expect(!Done->IsCancelled(), "Finished job counts as cancelled");
+
+		JobHandle_T<int32_t> Dependent = JobSystem.Schedule([Done]() { return Done->Await() + 1; }, Done);
+
+		b_Passed &= Expect(Dependent->Await() == 6, "Dependent of a finished job was dropped");
+
+		JobHandle_T<int32_t> Continuation = Done->Then(JobSystem, [](int32_t Value) { return Value * 2; });
+
+		b_Passed &= Expect(Continuation->Await() == 10, "Continuation of a finished job was dropped");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline TTask<int32_t> AwaitAndAdd(JobHandle_T<int32_t> Handle)
+	{
+		co_return co_await Handle + 1;
+	}
+
+	inline TTask<int32_t> Fail()
+	{
+		throw std::runtime_error("Task failed");
+
+		co_return 0;
+	}
+
+	inline TTask<int32_t> AwaitTask(TTask<int32_t> Task)
+	{
+		co_return co_await Task;
+	}
+
+	template<typename Exception_T, typename Functor_T>
+	bool Throws(Functor_T&& Functor)
+	{
+		try
+		{
+			Functor();
+		}
+		catch (const Exception_T&)
+		{
+			return true;
+		}
+		catch (...)
+		{
+		}
+
+		return false;
+	}
+
+	// co_await on a cancelled handle throws into the coroutine, which hands it on to whoever awaits the task.
+	inline bool TestAwaitCancelledHandle()
+	{
+		bool b_Passed = true;
+
+		JobHandle_T<int32_t> Cancelled = MakeJobHandle<int32_t>();
+
+		Cancelled->Cancel();
+		Cancelled->Signal();
+
+		TTask<int32_t> OnReady = AwaitAndAdd(Cancelled);
+
+		b_Passed &= Expect(Throws<FJobCancelledError>([&OnReady]() { OnReady.Await(); }), "Cancelled ready handle didn't throw");
+
+		JobHandle_T<int32_t> Pending = MakeJobHandle<int32_t>();
+
+		TTask<int32_t> OnPending = AwaitAndAdd(Pending);
+		TTask<int32_t> Outer     = AwaitTask(OnPending);
+
+		Pending->Cancel();
+		Pending->Signal();
+
+		b_Passed &= Expect(Throws<FJobCancelledError>([&Outer]() { Outer.Await(); }), "Cancellation didn't reach the outer task");
+
+		TTask<int32_t> Failed = AwaitTask(Fail());
+
+		b_Passed &= Expect(Throws<std::runtime_error>([&Failed]() { Failed.Await(); }), "Task exception didn't reach the awaiting task");
+
+		return b_Passed;
+	}
+
+	inline bool RunCancellationTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestCancelledPrerequisitePropagates();
+		b_Passed &= TestCancelAfterFinish();
+		b_Passed &= TestAwaitCancelledHandle();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
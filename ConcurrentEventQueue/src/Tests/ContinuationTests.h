@@ -0,0 +1,84 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+
+namespace t3d::test
+{
+	// Then() with a job system schedules on its workers, even when it's attached outside of them to a handle
+	// that has signaled already.
+	inline bool TestThenOnCompletedHandle()
+	{
+		bool b_Passed = true;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 2;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		JobHandle_T<int32_t> Source = JobSystem.Schedule([]() { return 21; });
+
+		Source->Wait();
+
+		JobHandle_T<uint32_t> Next = Source->Then(JobSystem, [](int32_t Value)
+			{
+				return Value == 21 ? CurrentWorkerIndex : NoWorkerIndex;
+			});
+
+		b_Passed &= Expect(Next->Await() < Config.WorkerCount, "Continuation didn't run on a worker or lost the result");
+
+		// Signaled by hand on this thread, nothing but the job system passed to Then() is known.
+		JobHandle_T<void> Manual = MakeJobHandle<void>();
+
+		JobHandle_T<uint32_t> AfterManual = Manual->Then(JobSystem, []() { return CurrentWorkerIndex; });
+
+		Manual->Signal();
+
+		b_Passed &= Expect(AfterManual->Await() < Config.WorkerCount, "Continuation of a manual signal didn't run on a worker");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	// A realtime worker only runs ScheduleRealtime jobs, continuations it attaches go to the regular workers.
+	inline bool TestThenFromRealtimeWorker()
+	{
+		FJobSystemConfig Config;
+
+		Config.WorkerCount         = 1;
+		Config.RealtimeWorkerCount = 1;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		JobHandle_T<void> Source = JobSystem.Schedule([]() {});
+
+		Source->Wait();
+
+		JobHandle_T<JobHandle_T<uint32_t>> Attached = JobSystem.ScheduleRealtime([Source]()
+			{
+				return Source->Then([]() { return CurrentWorkerIndex; });
+			});
+
+		const uint32_t WorkerIndex = Attached->Await()->Await();
+
+		JobSystem.Shutdown();
+
+		return Expect(WorkerIndex < Config.WorkerCount, "Continuation ran on the realtime worker");
+	}
+
+	inline bool RunContinuationTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestThenOnCompletedHandle();
+		b_Passed &= TestThenFromRealtimeWorker();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobCounter.h"
+#include "../FJobSystem.h"
+
+#include <atomic>
+
+namespace t3d::test
+{
+	// One decrement releases every wait whose target it reaches and leaves the others waiting.
+	inline bool TestCounterTargets()
+	{
+		bool b_Passed = true;
+
+		FJobCounter Counter(10);
+
+		JobHandle_T<void> Half    = Counter.When(5);
+		JobHandle_T<void> First   = Counter.When(0);
+		JobHandle_T<void> Second  = Counter.When(0);
+		JobHandle_T<void> Already = Counter.When(10);
+
+		b_Passed &= Expect(Already->IsReady(), "Wait on a target already reached didn't signal");
+
+		Counter.Decrement(3);
+
+		b_Passed &= Expect(!Half->IsReady(), "Wait released before its target");
+
+		Counter.Decrement(2);
+
+		b_Passed &= Expect(Half->IsReady(),                         "Wait not released at its target");
+		b_Passed &= Expect(!First->IsReady() && !Second->IsReady(), "Lower targets released early");
+
+		Counter.Decrement(5);
+
+		b_Passed &= Expect(First->IsReady() && Second->IsReady(), "Not every wait on zero was released");
+
+		return b_Passed;
+	}
+
+	// Wait returns only once every job scheduled against the counter has run, and a job behind When() runs after them.
+	inline bool TestCounterWait()
+	{
+		bool b_Passed = true;
+
+		constexpr uint32_t JobCount = 1000;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 4;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		for (uint32_t Round = 0; Round < 20; ++Round)
+		{
+			FJobCounter           Counter;
+			std::atomic<uint32_t> RunCount = 0;
+
+			for (uint32_t i = 0; i < JobCount; ++i)
+			{
+				JobSystem.Schedule(Counter, [&RunCount]() { RunCount.fetch_add(1); });
+			}
+
+			JobHandle_T<uint32_t> After = JobSystem.Schedule([&RunCount]() { return RunCount.load(); }, Counter.When());
+
+			Counter.Wait();
+
+			b_Passed &= Expect(RunCount.load() == JobCount, "Counter wait returned before its jobs ran");
+			b_Passed &= Expect(After->Await() == JobCount,  "Job behind the counter ran early");
+		}
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline bool RunCounterTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestCounterTargets();
+		b_Passed &= TestCounterWait();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace t3d::test
+{
+	// The gated job stays back until the last of its prerequisites has signaled.
+	inline bool TestJobWaitsForEveryPrerequisite()
+	{
+		bool b_Passed = true;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 2;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		JobHandle_T<void> First  = MakeJobHandle<void>();
+		JobHandle_T<void> Second = MakeJobHandle<void>();
+
+		std::atomic<bool> b_Ran = false;
+
+		JobHandle_T<void> Gated = JobSystem.Schedule([&b_Ran]() { b_Ran.store(true); }, First, Second);
+
+		First->Signal();
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+		b_Passed &= Expect(!b_Ran.load(), "Job ran before its second prerequisite signaled");
+
+		Second->Signal();
+
+		Gated->Wait();
+
+		b_Passed &= Expect(b_Ran.load(), "Job didn't run once its prerequisites signaled");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	// A diamond: the join sees the results of both branches, which both see the root's.
+	inline bool TestDependencyDiamond()
+	{
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 4;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		bool b_Passed = true;
+
+		for (int32_t Round = 0; Round < 200; ++Round)
+		{
+			JobHandle_T<int32_t> Root  = JobSystem.Schedule([Round]() { return Round; });
+			JobHandle_T<int32_t> Left  = JobSystem.Schedule([Root]() { return Root->Await() + 1; }, Root);
+			JobHandle_T<int32_t> Right = JobSystem.Schedule([Root]() { return Root->Await() * 2; }, Root);
+			JobHandle_T<int32_t> Join  = JobSystem.Schedule([Left, Right]() { return Left->Await() + Right->Await(); }, Left, Right);
+
+			if (!Expect(Join->Await() == Round * 3 + 1, "Join saw a wrong result"))
+			{
+				b_Passed = false;
+
+				break;
+			}
+		}
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline bool RunDependencyTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestJobWaitsForEveryPrerequisite();
+		b_Passed &= TestDependencyDiamond();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
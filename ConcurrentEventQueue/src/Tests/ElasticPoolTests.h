@@ -0,0 +1,69 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+#include "../FJobCounter.h"
+
+#include <chrono>
+#include <thread>
+
+namespace t3d::test
+{
+	// Wake-ups that find nothing to run don't keep a surplus worker alive, the pool shrinks back while jobs keep coming.
+	inline bool TestSurplusWorkersRetireUnderLoad()
+	{
+		bool b_Passed = true;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount     = 4;
+		Config.MinWorkerCount  = 1;
+		Config.SpawnQueueDepth = 4;
+		Config.SpawnDelay      = std::chrono::milliseconds(1);
+		Config.RetireTimeout   = std::chrono::milliseconds(100);
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		// A backlog of slow jobs grows the pool.
+		{
+			FJobCounter Counter;
+
+			for (size_t i = 0; i < 200; ++i)
+			{
+				JobSystem.Schedule(Counter, []() { std::this_thread::sleep_for(std::chrono::microseconds(200)); });
+			}
+
+			Counter.Wait();
+		}
+
+		b_Passed &= Expect(JobSystem.GetPoolStats().RunningWorkerCount > Config.MinWorkerCount, "Backlog didn't grow the pool");
+
+		// Every job spawns a child on the first worker's deque. That wakes an idle peer, but the first worker
+		// runs the child itself right after, so the peer keeps finding nothing.
+		const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+		while (JobSystem.GetPoolStats().RunningWorkerCount > Config.MinWorkerCount && std::chrono::steady_clock::now() < Deadline)
+		{
+			FJobCounter Counter;
+
+			JobSystem.Schedule(0, [&JobSystem, &Counter]() { JobSystem.Schedule(Counter, []() {}); })->Await();
+
+			Counter.Wait();
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		b_Passed &= Expect(JobSystem.GetPoolStats().RunningWorkerCount == Config.MinWorkerCount, "Surplus workers didn't retire while jobs kept coming");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline bool RunElasticPoolTests()
+	{
+		return TestSurplusWorkersRetireUnderLoad();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+#include "../TPerWorker.h"
+
+namespace t3d::test
+{
+	// A worker of another job system goes to the extra slot like any other outside thread, never to the slot
+	// of the worker with the same index.
+	inline bool TestPerWorkerOfAnotherSystem()
+	{
+		bool b_Passed = true;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 2;
+
+		FJobSystem Owner(Config);
+		FJobSystem Other(Config);
+
+		Owner.Startup();
+		Other.Startup();
+
+		TPerWorker<uint32_t> Counts(Owner, 0);
+
+		Owner.Schedule(0, [&Counts]() { ++Counts.Local(); })->Await();
+		Other.Schedule(0, [&Counts]() { ++Counts.Local(); })->Await();
+
+		// The other system's worker is done with the extra slot, this thread takes it over.
+		Counts.ReleaseExtraSlot();
+
+		++Counts.Local();
+
+		b_Passed &= Expect(Counts[0] == 1,                         "Worker 0 of the owner lost its count");
+		b_Passed &= Expect(Counts[Counts.GetSlotCount() - 1] == 2, "Other system's worker didn't go to the extra slot");
+		b_Passed &= Expect(Counts.Combine() == 3,                  "Counts went missing");
+
+		Other.Shutdown();
+		Owner.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline bool RunPerWorkerTests()
+	{
+		return TestPerWorkerOfAnotherSystem();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+#include "../FPipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace t3d::test
+{
+	struct FPipelineItem
+	{
+		uint32_t Index = 0;
+	};
+
+	// Items leave a serial-in-order stage in input order even though a parallel stage shuffles them, serial stages never
+	// run two items at once and no more than TokenCount items are ever in flight.
+	inline bool TestPipelineOrdering()
+	{
+		bool b_Passed = true;
+
+		constexpr uint32_t ItemCount  = 2000;
+		constexpr uint32_t TokenCount = 8;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 4;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		std::atomic<uint32_t> InFlight        = 0;
+		std::atomic<uint32_t> MaxInFlight     = 0;
+		std::atomic<uint32_t> InOrderBusy     = 0;
+		std::atomic<uint32_t> OutOfOrderBusy  = 0;
+		std::atomic<bool>     b_Overlapped    = false;
+		std::vector<uint32_t> Order;
+		uint32_t              OutOfOrderCount = 0;
+
+		Order.reserve(ItemCount);
+
+		TPipeline<FPipelineItem> Pipeline(JobSystem, TokenCount);
+
+		Pipeline
+			.AddStage(EPipelineStage::Parallel, [](FPipelineItem& Item)
+				{
+					// Uneven work so items overtake each other before the serial stage.
+					if (Item.Index % 7 == 0)
+					{
+						std::this_thread::sleep_for(std::chrono::microseconds(50));
+					}
+				})
+			.AddStage(EPipelineStage::SerialInOrder, [&Order, &InOrderBusy, &b_Overlapped](FPipelineItem& Item)
+				{
+					b_Overlapped.store(b_Overlapped.load() || InOrderBusy.fetch_add(1) != 0);
+
+					Order.push_back(Item.Index);
+
+					InOrderBusy.fetch_sub(1);
+				})
+			.AddStage(EPipelineStage::SerialOutOfOrder, [&OutOfOrderCount, &OutOfOrderBusy, &b_Overlapped, &InFlight](FPipelineItem&)
+				{
+					b_Overlapped.store(b_Overlapped.load() || OutOfOrderBusy.fetch_add(1) != 0);
+
+					++OutOfOrderCount;
+
+					OutOfOrderBusy.fetch_sub(1);
+
+					InFlight.fetch_sub(1);
+				});
+
+		uint32_t NextIndex = 0;
+
+		Pipeline.Run([&NextIndex, &InFlight, &MaxInFlight](FPipelineItem& Item)
+			{
+				if (NextIndex == ItemCount)
+				{
+					return false;
+				}
+
+				Item.Index = NextIndex++;
+
+				const uint32_t Count = InFlight.fetch_add(1) + 1;
+
+				MaxInFlight.store(std::max(MaxInFlight.load(), Count));
+
+				return true;
+			});
+
+		Pipeline.Wait();
+
+		bool b_InOrder = Order.size() == ItemCount;
+
+		for (uint32_t i = 0; b_InOrder && i < ItemCount; ++i)
+		{
+			b_InOrder = Order[i] == i;
+		}
+
+		b_Passed &= Expect(b_InOrder,                        "Serial in-order stage saw items out of input order");
+		b_Passed &= Expect(OutOfOrderCount == ItemCount,     "Serial out-of-order stage lost items");
+		b_Passed &= Expect(!b_Overlapped.load(),             "Serial stage ran two items at once");
+		b_Passed &= Expect(MaxInFlight.load() <= TokenCount, "More items in flight than tokens");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline bool RunPipelineTests()
+	{
+		return TestPipelineOrdering();
+	}
+}
\ No newline at end of file
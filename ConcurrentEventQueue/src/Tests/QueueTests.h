@@ -0,0 +1,127 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobQueue.h"
+#include "../TJob.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace t3d::test
+{
+	// The capacity rounds up to a power of two, a full queue refuses jobs and takes them again once one is popped.
+	inline bool TestQueueFull()
+	{
+		bool b_Passed = true;
+
+		FSlabPool Pool;
+		FJobQueue Queue(5);
+
+		b_Passed &= Expect(Queue.GetCapacity() == 8, "Capacity wasn't rounded up to a power of two");
+
+		uint32_t Accepted = 0;
+
+		for (uint32_t i = 0; i < 9; ++i)
+		{
+			Job_T Job(TDetachedJob<void(*)()>::Create(Pool, +[]() {}));
+
+			Accepted += Queue.TrySubmit(Job) ? 1 : 0;
+		}
+
+		b_Passed &= Expect(Accepted == 8 && Queue.Size() == 8, "Full queue accepted a job");
+
+		Job_T Front;
+
+		b_Passed &= Expect(Queue.TransferFront(Front), "Full queue had nothing to pop");
+
+		Job_T Job(TDetachedJob<void(*)()>::Create(Pool, +[]() {}));
+
+		b_Passed &= Expect(Queue.TrySubmit(Job), "Queue stayed full after a pop");
+
+		return b_Passed;
+	}
+
+	// Producers and consumers hammer a small ring over many laps, every job comes out exactly once.
+	inline bool TestQueueConcurrent()
+	{
+		constexpr uint32_t ProducerCount   = 4;
+		constexpr uint32_t ConsumerCount   = 4;
+		constexpr uint32_t JobsPerProducer = 50000;
+		constexpr uint32_t JobCount        = ProducerCount * JobsPerProducer;
+
+		FSlabPool Pool;
+		FJobQueue Queue(16);
+
+		std::unique_ptr<std::atomic<uint32_t>[]> Seen(new std::atomic<uint32_t>[JobCount]);
+
+		for (uint32_t i = 0; i < JobCount; ++i)
+		{
+			Seen[i].store(0, std::memory_order_relaxed);
+		}
+
+		std::atomic<uint32_t>    Consumed = 0;
+		std::vector<std::thread> Threads;
+
+		for (uint32_t p = 0; p < ProducerCount; ++p)
+		{
+			Threads.emplace_back([&Queue, &Pool, &Seen, p]()
+				{
+					for (uint32_t i = 0; i < JobsPerProducer; ++i)
+					{
+						auto Mark = [Slot = &Seen[p * JobsPerProducer + i]]() { Slot->fetch_add(1); };
+
+						Queue.Submit(Job_T(TDetachedJob<decltype(Mark)>::Create(Pool, Mark)));
+					}
+				});
+		}
+
+		for (uint32_t c = 0; c < ConsumerCount; ++c)
+		{
+			Threads.emplace_back([&Queue, &Consumed]()
+				{
+					Job_T Job;
+
+					while (Consumed.load() < JobCount)
+					{
+						if (Queue.TransferFront(Job))
+						{
+							Job->Execute();
+							Job.reset();
+
+							Consumed.fetch_add(1);
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+				});
+		}
+
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+
+		bool b_ExactlyOnce = true;
+
+		for (uint32_t i = 0; i < JobCount; ++i)
+		{
+			b_ExactlyOnce &= Seen[i].load() == 1;
+		}
+
+		return Expect(b_ExactlyOnce && Queue.IsEmpty(), "A job was lost or popped twice");
+	}
+
+	inline bool RunQueueTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestQueueFull();
+		b_Passed &= TestQueueConcurrent();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../Benchmark/AllocationCounter.h"
+#include "../FJobSystem.h"
+#include "../FJobCounter.h"
+#include "../FScratchArena.h"
+
+#include <thread>
+
+namespace t3d::test
+{
+	// Blocks grown inside a scope outlive it, the next scope of the same size runs off them.
+	inline bool TestScratchRewindKeepsBlocks()
+	{
+		bool b_Passed = true;
+
+		FScratchArena Arena(1024);
+
+		auto Fill = [&Arena]()
+			{
+				FScratchArena::FScope Scope(Arena);
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					Arena.Allocate(4 * 1024);
+				}
+			};
+
+		Fill();
+
+		const size_t   Capacity = Arena.GetCapacity();
+		const uint64_t Before   = benchmark::GetHeapAllocationCount();
+
+		for (size_t i = 0; i < 100; ++i)
+		{
+			Fill();
+		}
+
+		b_Passed &= Expect(benchmark::GetHeapAllocationCount() == Before, "Rewind gave blocks back to the heap");
+		b_Passed &= Expect(Arena.GetCapacity() == Capacity,               "Arena grew while reusing its blocks");
+		b_Passed &= Expect(Arena.GetUsedSize() == 0,                      "Scope didn't rewind");
+
+		Arena.Reset();
+
+		b_Passed &= Expect(Arena.GetCapacity() == Capacity, "Reset didn't keep the peak size");
+
+		// One merged block now, so a full scope fits without growing.
+		const uint64_t AfterReset = benchmark::GetHeapAllocationCount();
+
+		Fill();
+
+		b_Passed &= Expect(benchmark::GetHeapAllocationCount() == AfterReset, "Merged block didn't fit the peak");
+
+		return b_Passed;
+	}
+
+	// Once the worker's arena has reached its peak, jobs that take scratch cost no heap allocation at all.
+	inline bool TestScratchJobsDontAllocate()
+	{
+		constexpr size_t SizeSteps    = 200;
+		constexpr size_t WarmupJobs   = SizeSteps;
+		constexpr size_t MeasuredJobs = SizeSteps * 5;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 1;
+		Config.ScratchSize = 4 * 1024;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		auto RunJobs = [&JobSystem](size_t Count)
+			{
+				FJobCounter Counter;
+
+				for (size_t i = 0; i < Count; ++i)
+				{
+					// Sizes vary from job to job, so blocks are grown, rewound and picked up again.
+					const size_t Size = 1024 * (1 + i % SizeSteps);
+
+					JobSystem.Schedule(Counter, [Size]()
+						{
+							FScratchArena& Scratch = FScratchArena::GetCurrent();
+
+							uint8_t* Bytes = Scratch.Allocate<uint8_t>(Size);
+
+							Bytes[0] = Bytes[Size - 1] = 1;
+
+							FScratchArena::FScope Scope(Scratch);
+
+							Scratch.Allocate<uint8_t>(Size)[0] = 2;
+						});
+
+					// Polls instead of waiting, a wait handle would be an allocation of its own.
+					while (!Counter.IsDone())
+					{
+						std::this_thread::yield();
+					}
+				}
+			};
+
+		// The arena grows to its peak here.
+		RunJobs(WarmupJobs);
+
+		const uint64_t Before = benchmark::GetHeapAllocationCount();
+
+		RunJobs(MeasuredJobs);
+
+		const uint64_t After = benchmark::GetHeapAllocationCount();
+
+		JobSystem.Shutdown();
+
+		return Expect(After == Before, "Scratch-using jobs allocated from the heap");
+	}
+
+	inline bool RunScratchTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestScratchRewindKeepsBlocks();
+		b_Passed &= TestScratchJobsDontAllocate();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
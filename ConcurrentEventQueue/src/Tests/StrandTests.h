@@ -0,0 +1,89 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+#include "../FStrand.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace t3d::test
+{
+	// Several threads post to one strand at once. Jobs never overlap and each poster's jobs run in the order it posted
+	// them, also across the drain job requeueing itself after every quantum.
+	inline bool TestStrandOrdering()
+	{
+		constexpr uint32_t PosterCount   = 4;
+		constexpr uint32_t JobsPerPoster = 5000;
+
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 4;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		bool b_Passed = true;
+
+		{
+			FStrand Strand(JobSystem, EJobPriority::Normal, 4);
+
+			std::atomic<uint32_t> Busy         = 0;
+			std::atomic<bool>     b_Overlapped = false;
+			std::vector<uint32_t> LastSeen(PosterCount, 0);
+			bool                  b_InOrder    = true;
+			uint32_t              RunCount     = 0;
+
+			std::vector<std::thread>       Posters;
+			std::vector<JobHandle_T<void>> LastJobs(PosterCount);
+
+			for (uint32_t p = 0; p < PosterCount; ++p)
+			{
+				Posters.emplace_back([&, p]()
+					{
+						for (uint32_t i = 1; i <= JobsPerPoster; ++i)
+						{
+							LastJobs[p] = Strand.Schedule([&, p, i]()
+								{
+									b_Overlapped.store(b_Overlapped.load() || Busy.fetch_add(1) != 0);
+
+									// Plain data on purpose, the strand is the only thing serializing it.
+									b_InOrder   &= LastSeen[p] + 1 == i;
+									LastSeen[p]  = i;
+
+									++RunCount;
+
+									Busy.fetch_sub(1);
+								});
+						}
+					});
+			}
+
+			for (std::thread& Poster : Posters)
+			{
+				Poster.join();
+			}
+
+			for (JobHandle_T<void>& Last : LastJobs)
+			{
+				Last->Wait();
+			}
+
+			b_Passed &= Expect(WaitFor([&Strand]() { return Strand.IsIdle(); }), "Strand didn't go idle");
+			b_Passed &= Expect(RunCount == PosterCount * JobsPerPoster,          "Strand lost jobs");
+			b_Passed &= Expect(b_InOrder,                                        "Strand ran a poster's jobs out of order");
+			b_Passed &= Expect(!b_Overlapped.load(),                             "Strand ran two jobs at once");
+		}
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline bool RunStrandTests()
+	{
+		return TestStrandOrdering();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+#include "../TTask.h"
+
+#include <memory>
+
+namespace t3d::test
+{
+	inline TTask<int32_t> AddOne(JobHandle_T<int32_t> Handle)
+	{
+		co_return co_await Handle + 1;
+	}
+
+	inline TTask<std::unique_ptr<int32_t>> Box(TTask<int32_t> Task)
+	{
+		co_return std::make_unique<int32_t>(co_await Task);
+	}
+
+	// A ready handle doesn't suspend, the task is done by the time the coroutine call returns.
+	inline bool TestAwaitReadyHandle()
+	{
+		JobHandle_T<int32_t> Handle = MakeJobHandle<int32_t>();
+
+		Handle->Submit(41);
+		Handle->Signal();
+
+		TTask<int32_t> Task = AddOne(Handle);
+
+		bool b_Passed = true;
+
+		b_Passed &= Expect(Task.IsReady(),     "Task suspended on a ready handle");
+		b_Passed &= Expect(Task.Await() == 42, "Task returned a wrong result");
+
+		return b_Passed;
+	}
+
+	// A pending handle suspends the task, it resumes on the thread that signals and hands its result on to the next task.
+	inline bool TestAwaitPendingHandle()
+	{
+		JobHandle_T<int32_t> Handle = MakeJobHandle<int32_t>();
+
+		TTask<int32_t>                  Task  = AddOne(Handle);
+		TTask<std::unique_ptr<int32_t>> Boxed = Box(Task);
+
+		bool b_Passed = true;
+
+		b_Passed &= Expect(!Task.IsReady() && !Boxed.IsReady(),   "Task ran past a pending handle");
+
+		Handle->Submit(1);
+		Handle->Signal();
+
+		b_Passed &= Expect(Task.IsReady() && Boxed.IsReady(),     "Signal didn't resume the tasks");
+		b_Passed &= Expect(*Boxed.GetHandle()->TakeResult() == 2, "Boxed task returned a wrong result");
+
+		return b_Passed;
+	}
+
+	// Awaiting jobs on the pool: every task resumes on a worker once its job is done.
+	inline bool TestAwaitScheduledJobs()
+	{
+		FJobSystemConfig Config;
+
+		Config.WorkerCount = 2;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		bool b_Passed = true;
+
+		for (int32_t Round = 0; Round < 200 && b_Passed; ++Round)
+		{
+			TTask<int32_t> Task = AddOne(JobSystem.Schedule([Round]() { return Round; }));
+
+			b_Passed &= Expect(Task.Await() == Round + 1, "Task returned a wrong result");
+		}
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	inline bool RunTaskTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestAwaitReadyHandle();
+		b_Passed &= TestAwaitPendingHandle();
+		b_Passed &= TestAwaitScheduledJobs();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace t3d::test
+{
+	// Prints What when Condition doesn't hold and hands Condition back, so a test can fold its checks into one result.
+	inline bool Expect(bool b_Condition, const char* What)
+	{
+		if (!b_Condition)
+		{
+			std::printf("  failed: %s\n", What);
+		}
+
+		return b_Condition;
+	}
+
+	using TestClock_T = std::chrono::steady_clock;
+
+	// Polls until Condition holds or Timeout has passed, returns Condition.
+	template<typename Condition_T>
+	bool WaitFor(Condition_T&& Condition, std::chrono::milliseconds Timeout = std::chrono::seconds(5))
+	{
+		const TestClock_T::time_point Deadline = TestClock_T::now() + Timeout;
+
+		while (!Condition() && TestClock_T::now() < Deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		return Condition();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace t3d::test
+{
+	// A one-shot timer fires once and not before its delay. A cancelled one never fires.
+	inline bool TestOneShotTimer()
+	{
+		bool b_Passed = true;
+
+		FJobSystem JobSystem;
+
+		JobSystem.Startup();
+
+		std::atomic<int64_t>  FiredAfter = -1;
+		std::atomic<uint32_t> FireCount  = 0;
+		std::atomic<bool>     b_Dropped  = false;
+
+		const TestClock_T::time_point Start = TestClock_T::now();
+
+		JobSystem.ScheduleAfter(std::chrono::milliseconds(20), [&FiredAfter, &FireCount, Start]()
+			{
+				FiredAfter.store(std::chrono::duration_cast<std::chrono::milliseconds>(TestClock_T::now() - Start).count());
+				FireCount.fetch_add(1);
+			});
+
+		const FTimerId Cancelled = JobSystem.ScheduleAfter(std::chrono::milliseconds(20), [&b_Dropped]() { b_Dropped.store(true); });
+
+		b_Passed &= Expect(JobSystem.CancelTimer(Cancelled), "Pending timer couldn't be cancelled");
+
+		b_Passed &= Expect(WaitFor([&FireCount]() { return FireCount.load() > 0; }), "One-shot timer didn't fire");
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		b_Passed &= Expect(FiredAfter.load() >= 20, "Timer fired before its delay");
+		b_Passed &= Expect(FireCount.load() == 1,   "One-shot timer fired more than once");
+		b_Passed &= Expect(!b_Dropped.load(),       "Cancelled timer fired");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	// A periodic timer keeps firing until it is cancelled, then stops.
+	inline bool TestPeriodicTimer()
+	{
+		bool b_Passed = true;
+
+		FJobSystem JobSystem;
+
+		JobSystem.Startup();
+
+		std::atomic<uint32_t> FireCount = 0;
+
+		const FTimerId Id = JobSystem.ScheduleEvery(std::chrono::milliseconds(5), [&FireCount]() { FireCount.fetch_add(1); });
+
+		b_Passed &= Expect(WaitFor([&FireCount]() { return FireCount.load() >= 3; }), "Periodic timer didn't keep firing");
+		b_Passed &= Expect(JobSystem.CancelTimer(Id),                                 "Periodic timer couldn't be cancelled");
+
+		// A job handed out just before the cancel may still be on its way.
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+		const uint32_t AfterCancel = FireCount.load();
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		b_Passed &= Expect(FireCount.load() == AfterCancel, "Cancelled periodic timer kept firing");
+
+		JobSystem.Shutdown();
+
+		return b_Passed;
+	}
+
+	// A one-shot timer only moves its functor, so one that can't be copied is fine.
+	inline bool TestMoveOnlyTimer()
+	{
+		FJobSystem JobSystem;
+
+		JobSystem.Startup();
+
+		std::atomic<int32_t> Value = 0;
+
+		JobSystem.ScheduleAfter(std::chrono::milliseconds(1), [Boxed = std::make_unique<int32_t>(7), &Value]()
+			{
+				Value.store(*Boxed);
+			});
+
+		const bool b_Fired = WaitFor([&Value]() { return Value.load() == 7; });
+
+		JobSystem.Shutdown();
+
+		return Expect(b_Fired, "Move-only one-shot timer didn't fire");
+	}
+
+	inline bool RunTimerTests()
+	{
+		bool b_Passed = true;
+
+		b_Passed &= TestOneShotTimer();
+		b_Passed &= TestPeriodicTimer();
+		b_Passed &= TestMoveOnlyTimer();
+
+		return b_Passed;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "TestUtility.h"
+#include "../FJobSystem.h"
+
+#include <chrono>
+#include <thread>
+
+namespace t3d::test
+{
+	// A job the worker runs while helping in Await lies within the awaiting job's span and must not count twice.
+	inline bool TestNestedJobsCountOnce()
+	{
+		FJobSystemConfig Config;
+
+		Config.WorkerCount        = 1;
+		Config.TraceCapacity      = 64;
+		Config.b_HelpWhileWaiting = true;
+
+		FJobSystem JobSystem(Config);
+
+		JobSystem.Startup();
+
+		JobSystem.Schedule([&JobSystem]()
+			{
+				JobSystem.Schedule([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); })->Await();
+			})->Await();
+
+		const FJobTraceStats Stats = JobSystem.GetTraceStats();
+
+		JobSystem.Shutdown();
+
+		bool b_Passed = true;
+
+		b_Passed &= Expect(Stats.JobCount == 2,               "Tracer missed a job");
+		b_Passed &= Expect(Stats.WorkerUtilization[0] <= 1.0, "Nested job counted twice");
+		b_Passed &= Expect(Stats.WorkerUtilization[0] > 0.5,  "Busy time went missing");
+
+		return b_Passed;
+	}
+
+	inline bool RunTracerTests()
+	{
+		return TestNestedJobsCountOnce();
+	}
+}
\ No newline at end of file
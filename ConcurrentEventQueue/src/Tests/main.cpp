@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+
+#include "DependencyTests.h"
+#include "TaskTests.h"
+#include "TracerTests.h"
+#include "TimerTests.h"
+#include "CancellationTests.h"
+#include "PipelineTests.h"
+#include "QueueTests.h"
+#include "ScratchTests.h"
+#include "ContinuationTests.h"
+#include "CounterTests.h"
+#include "ElasticPoolTests.h"
+#include "StrandTests.h"
+#include "PerWorkerTests.h"
+
+struct FTestEntry
+{
+	const char* Name;
+	bool      (*Run)();
+};
+
+static const FTestEntry Tests[] =
+{
+	{ "dependency",   &t3d::test::RunDependencyTests   },
+	{ "task",         &t3d::test::RunTaskTests         },
+	{ "tracer",       &t3d::test::RunTracerTests       },
+	{ "timer",        &t3d::test::RunTimerTests        },
+	{ "cancellation", &t3d::test::RunCancellationTests },
+	{ "pipeline",     &t3d::test::RunPipelineTests     },
+	{ "queue",        &t3d::test::RunQueueTests        },
+	{ "scratch",      &t3d::test::RunScratchTests      },
+	{ "continuation", &t3d::test::RunContinuationTests },
+	{ "counter",      &t3d::test::RunCounterTests      },
+	{ "elastic",      &t3d::test::RunElasticPoolTests  },
+	{ "strand",       &t3d::test::RunStrandTests       },
+	{ "perworker",    &t3d::test::RunPerWorkerTests    },
+};
+
+int32_t main(int32_t ArgC, char* ArgV[])
+{
+	int32_t FailedCount = 0;
+
+	// No arguments runs everything, otherwise only the named tests.
+	for (const FTestEntry& Entry : Tests)
+	{
+		bool b_Selected = ArgC < 2;
+
+		for (int32_t i = 1; i < ArgC; ++i)
+		{
+			b_Selected |= std::strcmp(ArgV[i], Entry.Name) == 0;
+		}
+
+		if (!b_Selected)
+		{
+			continue;
+		}
+
+		const bool b_Passed = Entry.Run();
+
+		std::printf("%-12s %s\n", Entry.Name, b_Passed ? "passed" : "FAILED");
+
+		FailedCount += b_Passed ? 0 : 1;
+	}
+
+	return FailedCount == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -19,7 +19,7 @@ int32_t main(int32_t ArgC, const char* ArgV)
 
 	while (i++ < 5)
 	{
-		auto Handle = JobSystem.Schedule(t3d::EThreadId::Zero,
+		auto Handle = JobSystem.Schedule(0,
 			[&]()
 			{
 				A++;